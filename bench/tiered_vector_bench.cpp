@@ -0,0 +1,41 @@
+#include "../src/TieredVector.cpp"
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+using namespace aisdi;
+
+namespace
+{
+
+template <typename Collection>
+double middleInsertsPerSecond(std::size_t size, std::size_t inserts)
+{
+    Collection collection;
+    for (std::size_t i = 0; i < size; i++)
+        collection.append(i);
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < inserts; i++)
+        collection.insert(collection.begin() + collection.getSize() / 2, i);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    return inserts / elapsed.count();
+}
+
+} // namespace
+
+// Prints middle inserts per second of Vector and TieredVector for growing
+// sizes, the crossover is where the tiered column starts winning.
+int main()
+{
+    std::cout << "size\tVector\tTieredVector" << std::endl;
+    for (std::size_t size = 10; size <= 10000000; size *= 10)
+    {
+        std::size_t inserts = size < 100000 ? 10000 : 200;
+        std::cout << size << '\t'
+                  << middleInsertsPerSecond<Vector<std::uint64_t>>(size, inserts) << '\t'
+                  << middleInsertsPerSecond<TieredVector<std::uint64_t>>(size, inserts) << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+#ifndef AISDI_LINEAR_DICT_VECTOR_H
+#define AISDI_LINEAR_DICT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <unordered_map>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief Dictionary encoded vector for columns with few distinct values.
+ *        Every distinct value is stored once, the column itself is a vector
+ *        of Code indexes into the dictionary. Appending throws
+ *        std::length_error when Code cannot number another distinct value.
+ */
+template <typename Type, typename Code = std::uint16_t>
+class DictVector
+{
+public:
+  using size_type = std::size_t;
+  using value_type = Type;
+  using code_type = Code;
+
+  class ConstIterator;
+  using const_iterator = ConstIterator;
+
+  DictVector() {}
+  DictVector(std::initializer_list<Type> l);
+
+  const Type &operator[](const size_type index) const;
+
+  bool isEmpty() const { return _codes.isEmpty(); }
+  size_type getSize() const { return _codes.getSize(); }
+  size_type getDictionarySize() const { return _dictionary.getSize(); }
+  const Vector<Type> &getDictionary() const { return _dictionary; }
+  const Vector<Code> &getCodes() const { return _codes; }
+
+  void append(const Type &item);
+  bool findCode(const Type &value, Code &code) const;
+
+  // filters compare codes only, the value is looked up once
+  size_type countEqual(const Type &value) const;
+  void findEqual(const Type &value, Vector<size_type> &out) const;
+
+  void materialize(Vector<Type> &out) const;
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end() const { return const_iterator(this, getSize()); }
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+private:
+  Vector<Type> _dictionary;
+  Vector<Code> _codes;
+  std::unordered_map<Type, Code> _lookup;
+};
+
+template <typename Type, typename Code>
+class DictVector<Type, Code>::ConstIterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = Type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const Type *;
+  using reference = const Type &;
+
+  ConstIterator() : _vec(nullptr), _position(0) {}
+  ConstIterator(const DictVector *vec, size_type position) : _vec(vec), _position(position) {}
+
+  reference operator*() const { return (*_vec)[_position]; }
+
+  ConstIterator &operator++()
+  {
+    ++_position;
+    return *this;
+  }
+
+  ConstIterator operator++(int)
+  {
+    auto temp = *this;
+    ++_position;
+    return temp;
+  }
+
+  bool operator==(const ConstIterator &other) const { return _position == other._position; }
+  bool operator!=(const ConstIterator &other) const { return !(*this == other); }
+
+private:
+  const DictVector *_vec;
+  size_type _position;
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_DICT_VECTOR_H
@@ -0,0 +1,86 @@
+#ifndef AISDI_LINEAR_EXTERNAL_VECTOR_H
+#define AISDI_LINEAR_EXTERNAL_VECTOR_H
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <string>
+#include <type_traits>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief append-only vector that can outgrow memory. Elements collect in an
+ *        in-memory tail block; a full tail is sealed and written to an
+ *        unlinked temporary file by a background task while appends go on
+ *        into a second buffer. Scans read the next block ahead while the
+ *        current one is visited, and sort is an external merge sort. At
+ *        most four blocks are held in memory, so a block is a quarter of
+ *        the memory budget. I/O errors throw std::system_error.
+ */
+template <typename Type>
+class ExternalVector
+{
+  static_assert(std::is_trivially_copyable<Type>::value, "ExternalVector stores elements as raw bytes");
+
+public:
+  using size_type = std::size_t;
+  using value_type = Type;
+
+  static const size_type DefaultMemoryBudget = size_type(64) << 20;
+
+  // directory defaults to $TMPDIR, then /tmp
+  explicit ExternalVector(size_type memoryBudget = DefaultMemoryBudget, const std::string &directory = "");
+  ExternalVector(const ExternalVector &) = delete;
+  ExternalVector &operator=(const ExternalVector &) = delete;
+  ~ExternalVector();
+
+  bool isEmpty() const { return getSize() == 0; }
+  size_type getSize() const { return _spilled * _blockSize + _tail.getSize(); }
+  size_type getBlockSize() const { return _blockSize; }
+  size_type getSpilledBlocks() const { return _spilled; }
+  size_type getMemoryBudget() const { return _budget; }
+
+  void append(const Type &item);
+  // reads a single element, from disk if it was spilled
+  Type get(size_type index) const;
+  // waits until every sealed block is on disk
+  void flush() const;
+
+  // visit(items, count) for every block in order, the tail last
+  template <typename Visit>
+  void scan(Visit visit) const;
+  template <typename Visit>
+  void forEach(Visit visit) const;
+
+  /**
+   * @brief sorts the blocks one by one in memory, then merges the runs
+   *        with as many inputs at a time as fit in the budget, in as many
+   *        passes as needed. Not stable.
+   */
+  template <typename Compare = std::less<Type>>
+  void sort(Compare compare = Compare());
+
+private:
+  std::string _directory;
+  int _fd;
+  size_type _budget;
+  size_type _blockSize; // elements per block
+  size_type _spilled;   // blocks on disk
+  Vector<Type> _tail;
+  Vector<Type> _writing; // block being written in the background
+  mutable std::future<void> _pendingWrite;
+
+  void spillTail();
+  void readElements(size_type first, size_type count, Type *out) const;
+
+  template <typename Compare>
+  void mergePass(int from, int to, Vector<size_type> &runs, size_type fanIn, Compare &compare);
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_EXTERNAL_VECTOR_H
@@ -0,0 +1,221 @@
+#ifndef AISDI_LINEAR_GAP_VECTOR_H
+#define AISDI_LINEAR_GAP_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+namespace aisdi
+{
+
+/**
+ * @brief Vector with a gap of free slots kept at the cursor. Inserting and
+ *        erasing at the cursor is O(1), moving the cursor costs the distance
+ *        it moves. Edits at other positions move the cursor there first.
+ *        Reading API matches Vector, iterators skip the gap.
+ */
+template <typename Type>
+class GapVector
+{
+public:
+  using difference_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+  using value_type = Type;
+  using pointer = Type *;
+  using reference = Type &;
+  using const_pointer = const Type *;
+  using const_reference = const Type &;
+
+  class ConstIterator;
+  class Iterator;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  GapVector();
+  GapVector(std::initializer_list<Type> l);
+  GapVector(const GapVector &other);
+  GapVector(GapVector &&other);
+  ~GapVector() { delete[] _array; }
+
+  GapVector &operator=(const GapVector &other);
+  GapVector &operator=(GapVector &&other);
+  Type &operator[](const size_type index);
+  const Type &operator[](const size_type index) const;
+
+  bool isEmpty() const { return getSize() == 0; }
+  size_type getSize() const { return _capacity - (_gapEnd - _gapBegin); }
+  size_type getCapacity() const { return _capacity; }
+  size_type getCursor() const { return _gapBegin; }
+
+  void moveCursor(size_type position);
+  void insertAtCursor(const Type &item);
+  void eraseBeforeCursor();
+  void eraseAfterCursor();
+
+  void append(const Type &item);
+  void prepend(const Type &item);
+  void insert(const const_iterator &insertPosition, const Type &item);
+
+  Type popFirst();
+  Type popLast();
+
+  void erase(const const_iterator &possition);
+  void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded);
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, getSize()); }
+  const_iterator cbegin() const { return const_iterator(this, 0); }
+  const_iterator cend() const { return const_iterator(this, getSize()); }
+  const_iterator begin() const { return cbegin(); }
+  const_iterator end() const { return cend(); }
+
+private:
+  Type *_array;
+  size_type _capacity;
+  size_type _gapBegin; // first free slot, equal to the cursor
+  size_type _gapEnd;   // first used slot after the gap
+
+  static const size_type _defaultCapacity = 8;
+
+  size_type physicalIndex(size_type index) const { return index < _gapBegin ? index : index + (_gapEnd - _gapBegin); }
+  void grow();
+};
+
+template <typename Type>
+class GapVector<Type>::ConstIterator
+{
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename GapVector::value_type;
+  using difference_type = typename GapVector::difference_type;
+  using pointer = typename GapVector::const_pointer;
+  using reference = typename GapVector::const_reference;
+
+  explicit ConstIterator() : _vec(nullptr), _position(0) {}
+  ConstIterator(const GapVector<Type> *vec, size_type position) : _vec(vec), _position(position) {}
+
+  reference operator*() const
+  {
+    if (_vec == nullptr || _position >= _vec->getSize())
+      throw std::out_of_range("Dereferencing end iterator");
+    return _vec->_array[_vec->physicalIndex(_position)];
+  }
+
+  ConstIterator &operator++()
+  {
+    if (_vec == nullptr || _position >= _vec->getSize())
+      throw std::out_of_range("Incrementign end iterator");
+    ++_position;
+    return *this;
+  }
+
+  ConstIterator operator++(int)
+  {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  ConstIterator &operator--()
+  {
+    if (_position == 0)
+      throw std::out_of_range("Decrementing begin iterator");
+    --_position;
+    return *this;
+  }
+
+  ConstIterator operator--(int)
+  {
+    auto temp = *this;
+    --*this;
+    return temp;
+  }
+
+  ConstIterator operator+(difference_type d) const
+  {
+    if (_vec == nullptr || _position + d > _vec->getSize())
+      throw std::out_of_range("Adding to iterator passed the end");
+    return ConstIterator(_vec, _position + d);
+  }
+
+  ConstIterator operator-(difference_type d) const
+  {
+    if (static_cast<difference_type>(_position) - d < 0)
+      throw std::out_of_range("Substracting iterator pass zero");
+    return ConstIterator(_vec, _position - d);
+  }
+
+  bool operator==(const ConstIterator &other) const
+  {
+    return _vec == other._vec && _position == other._position;
+  }
+
+  bool operator!=(const ConstIterator &other) const
+  {
+    return !(*this == other);
+  }
+
+  size_type getPosition() const { return _position; }
+
+protected:
+  const GapVector<Type> *_vec;
+  size_type _position;
+};
+
+template <typename Type>
+class GapVector<Type>::Iterator : public GapVector<Type>::ConstIterator
+{
+public:
+  using pointer = typename GapVector::pointer;
+  using reference = typename GapVector::reference;
+
+  explicit Iterator() : ConstIterator() {}
+  Iterator(GapVector<Type> *vec, size_type position) : ConstIterator(vec, position) {}
+  Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+  Iterator &operator++()
+  {
+    ConstIterator::operator++();
+    return *this;
+  }
+
+  Iterator operator++(int)
+  {
+    auto result = *this;
+    ConstIterator::operator++();
+    return result;
+  }
+
+  Iterator &operator--()
+  {
+    ConstIterator::operator--();
+    return *this;
+  }
+
+  Iterator operator--(int)
+  {
+    auto result = *this;
+    ConstIterator::operator--();
+    return result;
+  }
+
+  Iterator operator+(difference_type d) const
+  {
+    return ConstIterator::operator+(d);
+  }
+
+  Iterator operator-(difference_type d) const
+  {
+    return ConstIterator::operator-(d);
+  }
+
+  reference operator*() const
+  {
+    return const_cast<reference>(ConstIterator::operator*());
+  }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_GAP_VECTOR_H
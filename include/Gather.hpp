@@ -0,0 +1,44 @@
+#ifndef AISDI_LINEAR_GATHER_H
+#define AISDI_LINEAR_GATHER_H
+
+#include <cstddef>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * Indexed copies between Vectors. Indices are checked once up front, with
+ * std::out_of_range for any index outside the source (gather) or the
+ * destination (scatter), and the copy itself runs unchecked. Elements
+ * prefetchDistance positions ahead are prefetched, 0 turns that off. With
+ * AVX2 enabled, 4 and 8 byte trivially copyable elements are moved with
+ * hardware gathers.
+ */
+const std::size_t DefaultPrefetchDistance = 16;
+
+// destination[i] = source[indices[i]], destination resized to indices
+template <typename Type, typename Index>
+void gather(const Vector<Type> &source, const Vector<Index> &indices, Vector<Type> &destination,
+            std::size_t prefetchDistance = DefaultPrefetchDistance);
+
+// destination[indices[i]] = source[i]; throws std::invalid_argument when
+// source and indices differ in size
+template <typename Type, typename Index>
+void scatter(const Vector<Type> &source, const Vector<Index> &indices, Vector<Type> &destination,
+             std::size_t prefetchDistance = DefaultPrefetchDistance);
+
+/**
+ * @brief reorders values in place so that values[i] becomes the old
+ *        values[permutation[i]], following the cycles of the permutation
+ *        with one temporary element and a bit per position. Throws
+ *        std::invalid_argument when permutation is not a permutation of
+ *        [0, size).
+ */
+template <typename Type, typename Index>
+void applyPermutation(Vector<Type> &values, const Vector<Index> &permutation);
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_GATHER_H
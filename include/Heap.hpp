@@ -0,0 +1,86 @@
+#ifndef AISDI_LINEAR_HEAP_H
+#define AISDI_LINEAR_HEAP_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+// default IdOf of Heap: no position map, decreaseKey unavailable
+struct NoPositionMap
+{
+};
+
+/**
+ * @brief priority queue over a Vector, stored as an implicit Arity-ary
+ *        tree. top() is the element that compares before all others, so
+ *        the default std::less gives a min-heap. Wider nodes make the tree
+ *        shallower and put all children of a node in one or two cache
+ *        lines. With an IdOf functor mapping elements to small integer ids
+ *        the heap keeps the position of every id and supports decreaseKey.
+ */
+template <typename Type, typename Compare = std::less<Type>, std::size_t Arity = 4, typename IdOf = NoPositionMap>
+class Heap
+{
+  static_assert(Arity >= 2, "Heap arity must be at least 2");
+
+public:
+  using size_type = std::size_t;
+  using value_type = Type;
+
+  explicit Heap(Compare compare = Compare(), IdOf idOf = IdOf()) : _compare(compare), _idOf(idOf) {}
+
+  bool isEmpty() const { return _items.isEmpty(); }
+  size_type getSize() const { return _items.getSize(); }
+
+  // throw std::length_error on an empty heap
+  const Type &top() const;
+  Type pop();
+
+  void push(const Type &item);
+
+  /**
+   * @brief adds count items. A batch larger than the heap is appended and
+   *        the whole heap rebuilt bottom up in O(n); smaller ones are pushed
+   *        one by one.
+   */
+  void pushRange(const Type *items, size_type count);
+  void pushRange(const Vector<Type> &items) { pushRange(items.data(), items.getSize()); }
+
+  // both need IdOf; decreaseKey throws std::invalid_argument for an absent
+  // id or a value that would move the element down
+  bool contains(size_type id) const;
+  void decreaseKey(size_type id, const Type &value);
+
+private:
+  static constexpr bool _tracksPositions = !std::is_same<IdOf, NoPositionMap>::value;
+  static constexpr size_type _absent = static_cast<size_type>(-1);
+
+  Vector<Type> _items;
+  Vector<size_type> _positions; // heap position of every id, _absent if none
+  Compare _compare;
+  IdOf _idOf;
+
+  void siftUp(size_type position);
+  void siftDown(size_type position);
+  void heapify();
+  void place(size_type position);
+  void track(const Type &item, size_type position);
+};
+
+/**
+ * @brief leaves the k elements of items that compare first, in order,
+ *        dropping the rest. Keeps a heap of the best k seen so far with the
+ *        worst of them on top, in items' own buffer; O(n log k).
+ */
+template <typename Type, typename Compare = std::less<Type>>
+void topK(Vector<Type> &items, std::size_t k, Compare compare = Compare());
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_HEAP_H
@@ -0,0 +1,167 @@
+#ifndef AISDI_LINEAR_INPLACE_VECTOR_H
+#define AISDI_LINEAR_INPLACE_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+template <typename Type>
+struct IsInplaceTrivial
+    : std::integral_constant<bool, std::is_trivially_copyable<Type>::value &&
+                                       std::is_trivially_default_constructible<Type>::value>
+{
+};
+
+/**
+ * Storage of InplaceVector. Trivial types live in a plain array so the whole
+ * vector stays trivially copyable and usable in constant expressions (at the
+ * price of zeroing the array on construction). Other types live in raw
+ * bytes and only the first _size slots hold constructed objects.
+ */
+template <typename Type, std::size_t Capacity, bool Trivial = IsInplaceTrivial<Type>::value>
+class InplaceStorage
+{
+protected:
+  constexpr InplaceStorage() : _items{}, _size(0) {}
+
+  constexpr Type *slot(std::size_t index) { return &_items[index]; }
+  constexpr const Type *slot(std::size_t index) const { return &_items[index]; }
+
+  template <typename Value>
+  constexpr void construct(std::size_t index, Value &&value) { _items[index] = std::forward<Value>(value); }
+  constexpr void destroy(std::size_t) {}
+
+  Type _items[Capacity > 0 ? Capacity : 1];
+  std::size_t _size;
+};
+
+template <typename Type, std::size_t Capacity>
+class InplaceStorage<Type, Capacity, false>
+{
+protected:
+  InplaceStorage() : _size(0) {}
+  InplaceStorage(const InplaceStorage &other) : _size(0)
+  {
+    for (; _size < other._size; ++_size)
+      construct(_size, *other.slot(_size));
+  }
+  InplaceStorage(InplaceStorage &&other) : _size(0)
+  {
+    for (; _size < other._size; ++_size)
+      construct(_size, std::move(*other.slot(_size)));
+  }
+  ~InplaceStorage() { clear(); }
+
+  InplaceStorage &operator=(const InplaceStorage &other)
+  {
+    if (this != &other)
+    {
+      clear();
+      for (; _size < other._size; ++_size)
+        construct(_size, *other.slot(_size));
+    }
+    return *this;
+  }
+  InplaceStorage &operator=(InplaceStorage &&other)
+  {
+    if (this != &other)
+    {
+      clear();
+      for (; _size < other._size; ++_size)
+        construct(_size, std::move(*other.slot(_size)));
+    }
+    return *this;
+  }
+
+  Type *slot(std::size_t index) { return reinterpret_cast<Type *>(_bytes) + index; }
+  const Type *slot(std::size_t index) const { return reinterpret_cast<const Type *>(_bytes) + index; }
+
+  template <typename Value>
+  void construct(std::size_t index, Value &&value) { new (slot(index)) Type(std::forward<Value>(value)); }
+  void destroy(std::size_t index) { slot(index)->~Type(); }
+
+  void clear()
+  {
+    while (_size > 0)
+      destroy(--_size);
+  }
+
+  alignas(Type) unsigned char _bytes[(Capacity > 0 ? Capacity : 1) * sizeof(Type)];
+  std::size_t _size;
+};
+
+} // namespace detail
+
+/**
+ * @brief Vector with a fixed capacity stored inside the object, it never
+ *        allocates. append and the other growing operations throw
+ *        std::length_error when the vector is full, tryAppend reports it
+ *        instead.
+ */
+template <typename Type, std::size_t Capacity>
+class InplaceVector : private detail::InplaceStorage<Type, Capacity>
+{
+  using Storage = detail::InplaceStorage<Type, Capacity>;
+
+public:
+  using difference_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+  using value_type = Type;
+  using pointer = Type *;
+  using reference = Type &;
+  using const_pointer = const Type *;
+  using const_reference = const Type &;
+  using iterator = Type *;
+  using const_iterator = const Type *;
+
+  constexpr InplaceVector() {}
+  constexpr InplaceVector(std::initializer_list<Type> l);
+
+  constexpr Type &operator[](const size_type index);
+  constexpr const Type &operator[](const size_type index) const;
+
+  constexpr bool isEmpty() const { return this->_size == 0; }
+  constexpr bool isFull() const { return this->_size == Capacity; }
+  constexpr size_type getSize() const { return this->_size; }
+  static constexpr size_type getCapacity() { return Capacity; }
+  constexpr Type *data() { return this->slot(0); }
+  constexpr const Type *data() const { return this->slot(0); }
+
+  constexpr void append(const Type &item);
+  constexpr void append(Type &&item);
+  constexpr bool tryAppend(const Type &item) noexcept(std::is_nothrow_copy_constructible<Type>::value);
+  constexpr bool tryAppend(Type &&item) noexcept(std::is_nothrow_move_constructible<Type>::value);
+  constexpr void prepend(const Type &item);
+  constexpr void insert(const_iterator insertPosition, const Type &item);
+
+  constexpr Type popFirst();
+  constexpr Type popLast();
+
+  constexpr void erase(const_iterator possition);
+  constexpr void erase(const_iterator firstIncluded, const_iterator lastExcluded);
+  constexpr void clear();
+
+  constexpr iterator begin() { return data(); }
+  constexpr iterator end() { return data() + this->_size; }
+  constexpr const_iterator cbegin() const { return data(); }
+  constexpr const_iterator cend() const { return data() + this->_size; }
+  constexpr const_iterator begin() const { return cbegin(); }
+  constexpr const_iterator end() const { return cend(); }
+
+private:
+  constexpr void shiftRight(size_type from);
+  constexpr void shiftLeft(size_type from, size_type jump);
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_INPLACE_VECTOR_H
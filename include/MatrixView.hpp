@@ -0,0 +1,103 @@
+#ifndef AISDI_LINEAR_MATRIX_VIEW_H
+#define AISDI_LINEAR_MATRIX_VIEW_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+enum class Layout
+{
+  RowMajor,
+  ColumnMajor
+};
+
+/**
+ * @brief two dimensional view over memory owned by someone else, usually a
+ *        Vector. Element (r, c) lives at data()[r * rowStride + c * columnStride],
+ *        so transposing or taking a block only changes the strides and the
+ *        origin; the elements are never copied. Type may be const.
+ */
+template <typename Type>
+class BasicMatrixView
+{
+public:
+  using size_type = std::size_t;
+  using value_type = typename std::remove_const<Type>::type;
+  using pointer = Type *;
+  using reference = Type &;
+
+  BasicMatrixView() : _data(nullptr), _rows(0), _columns(0), _rowStride(0), _columnStride(0) {}
+  BasicMatrixView(Type *data, size_type rows, size_type columns, size_type rowStride, size_type columnStride)
+      : _data(data), _rows(rows), _columns(columns), _rowStride(rowStride), _columnStride(columnStride) {}
+  BasicMatrixView(Vector<value_type> &storage, size_type rows, size_type columns, Layout layout = Layout::RowMajor);
+  BasicMatrixView(const Vector<value_type> &storage, size_type rows, size_type columns, Layout layout = Layout::RowMajor);
+
+  // a view of mutable elements converts to a view of const ones
+  template <typename Other, typename = typename std::enable_if<std::is_same<const Other, Type>::value>::type>
+  BasicMatrixView(const BasicMatrixView<Other> &other)
+      : _data(other.data()), _rows(other.getRows()), _columns(other.getColumns()),
+        _rowStride(other.getRowStride()), _columnStride(other.getColumnStride()) {}
+
+  reference operator()(size_type row, size_type column) const;
+
+  size_type getRows() const { return _rows; }
+  size_type getColumns() const { return _columns; }
+  size_type getRowStride() const { return _rowStride; }
+  size_type getColumnStride() const { return _columnStride; }
+  pointer data() const { return _data; }
+
+  bool isRowMajor() const { return _columnStride == 1; }
+  bool isColumnMajor() const { return _rowStride == 1; }
+
+  BasicMatrixView transposed() const { return BasicMatrixView(_data, _columns, _rows, _columnStride, _rowStride); }
+  BasicMatrixView block(size_type row, size_type column, size_type rows, size_type columns) const;
+
+private:
+  Type *_data;
+  size_type _rows;
+  size_type _columns;
+  size_type _rowStride;
+  size_type _columnStride;
+};
+
+using MatrixView = BasicMatrixView<double>;
+using ConstMatrixView = BasicMatrixView<const double>;
+
+/**
+ * Kernels over matrix views. They pick the loop order from the strides so
+ * that the inner loop walks contiguous memory whenever one of the strides
+ * is 1. Shape mismatches throw std::invalid_argument.
+ */
+
+// copies the transpose of source into destination, tile by tile
+template <typename Source, typename Type>
+void transpose(const BasicMatrixView<Source> &source, const BasicMatrixView<Type> &destination);
+
+/**
+ * @brief folds every row (column) from 'initial' with combine(accumulator,
+ *        element) in column (row) order, one result per row (column).
+ */
+template <typename Type, typename Accumulator, typename Combine>
+Vector<Accumulator> reduceRows(const BasicMatrixView<Type> &matrix, const Accumulator &initial, Combine combine);
+
+template <typename Type, typename Accumulator, typename Combine>
+Vector<Accumulator> reduceColumns(const BasicMatrixView<Type> &matrix, const Accumulator &initial, Combine combine);
+
+template <typename Type>
+Vector<typename std::remove_const<Type>::type> rowSums(const BasicMatrixView<Type> &matrix);
+
+template <typename Type>
+Vector<typename std::remove_const<Type>::type> columnSums(const BasicMatrixView<Type> &matrix);
+
+// result = matrix * vector, resized to the number of rows
+template <typename Matrix, typename Type>
+void multiply(const BasicMatrixView<Matrix> &matrix, const Vector<Type> &vector, Vector<Type> &result);
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_MATRIX_VIEW_H
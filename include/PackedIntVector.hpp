@@ -0,0 +1,120 @@
+#ifndef AISDI_LINEAR_PACKED_INT_VECTOR_H
+#define AISDI_LINEAR_PACKED_INT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief Append-only vector of unsigned integers stored bit-packed in blocks
+ *        of BlockSize values. Every block picks the smallest bit width that
+ *        holds its values, optionally relative to the block minimum
+ *        (FrameOfReference) or as zigzag deltas of neighbours (Delta).
+ *        The last, unfinished block is kept unpacked.
+ */
+class PackedIntVector
+{
+public:
+  using size_type = std::size_t;
+  using value_type = std::uint64_t;
+
+  enum class Encoding
+  {
+    Plain,
+    FrameOfReference,
+    Delta
+  };
+
+  static const size_type BlockSize = 128;
+
+  class ConstIterator;
+  using const_iterator = ConstIterator;
+
+  explicit PackedIntVector(Encoding encoding = Encoding::Plain);
+  PackedIntVector(std::initializer_list<value_type> l, Encoding encoding = Encoding::Plain);
+
+  value_type operator[](const size_type index) const;
+
+  bool isEmpty() const { return _size == 0; }
+  size_type getSize() const { return _size; }
+  Encoding getEncoding() const { return _encoding; }
+  size_type getBlockCount() const { return (_size + BlockSize - 1) / BlockSize; }
+  size_type getMemoryUsage() const;
+
+  void append(value_type item);
+
+  // writes all values of the block into out (at least BlockSize slots),
+  // returns number of values written
+  size_type decodeBlock(size_type blockIndex, value_type *out) const;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+private:
+  struct Block
+  {
+    value_type base;
+    size_type wordOffset;
+    unsigned width;
+  };
+
+  Vector<std::uint64_t> _words;
+  Vector<Block> _blocks;
+  value_type _tail[BlockSize];
+  size_type _tailSize;
+  size_type _size;
+  value_type _lastSealed;
+  Encoding _encoding;
+
+  void sealTail();
+  value_type decodeOne(size_type blockIndex, size_type offset) const;
+
+  static unsigned bitWidth(value_type value);
+  static void packBits(const value_type *in, size_type n, unsigned width, Vector<std::uint64_t> &out);
+  static void unpackBits(const std::uint64_t *words, size_type n, unsigned width, value_type *out);
+};
+
+class PackedIntVector::ConstIterator
+{
+public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = PackedIntVector::value_type;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const value_type *;
+  using reference = const value_type &;
+
+  ConstIterator() : _vec(nullptr), _position(0), _block(0) {}
+  ConstIterator(const PackedIntVector *vec, size_type position);
+
+  reference operator*() const;
+  ConstIterator &operator++();
+  ConstIterator operator++(int)
+  {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  bool operator==(const ConstIterator &other) const { return _position == other._position; }
+  bool operator!=(const ConstIterator &other) const { return !(*this == other); }
+
+private:
+  const PackedIntVector *_vec;
+  size_type _position;
+  size_type _block;
+  value_type _buffer[BlockSize];
+
+  void load();
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_PACKED_INT_VECTOR_H
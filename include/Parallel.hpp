@@ -0,0 +1,75 @@
+#ifndef AISDI_LINEAR_PARALLEL_H
+#define AISDI_LINEAR_PARALLEL_H
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+namespace parallel
+{
+
+inline std::size_t defaultThreadCount()
+{
+  unsigned hardware = std::thread::hardware_concurrency();
+  return hardware > 0 ? hardware : 1;
+}
+
+/**
+ * @brief calls task(index) for index in [0, threads), each on its own
+ *        thread, and waits for all of them. Index 0 runs on the calling
+ *        thread. The first exception thrown by a task is rethrown.
+ */
+template <typename Task>
+void runOnThreads(std::size_t threads, Task task)
+{
+  if (threads <= 1)
+  {
+    task(std::size_t(0));
+    return;
+  }
+
+  Vector<std::exception_ptr> errors(threads);
+  Vector<std::thread> workers(threads - 1);
+  for (std::size_t i = 1; i < threads; ++i)
+    workers[i - 1] = std::thread([&task, &errors, i] {
+      try
+      {
+        task(i);
+      }
+      catch (...)
+      {
+        errors[i] = std::current_exception();
+      }
+    });
+
+  try
+  {
+    task(std::size_t(0));
+  }
+  catch (...)
+  {
+    errors[0] = std::current_exception();
+  }
+
+  for (std::size_t i = 0; i + 1 < threads; ++i)
+    workers[i].join();
+  for (std::size_t i = 0; i < threads; ++i)
+    if (errors[i])
+      std::rethrow_exception(errors[i]);
+}
+
+// splits [0, size) into 'parts' nearly equal chunks, returns chunk 'part'
+inline void chunkBounds(std::size_t size, std::size_t parts, std::size_t part, std::size_t &begin, std::size_t &end)
+{
+  begin = size / parts * part + (part < size % parts ? part : size % parts);
+  end = begin + size / parts + (part < size % parts ? 1 : 0);
+}
+
+} // namespace parallel
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_PARALLEL_H
@@ -0,0 +1,41 @@
+#ifndef AISDI_LINEAR_PARTITION_H
+#define AISDI_LINEAR_PARTITION_H
+
+#include <cstddef>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * Radix partitioning of a Vector by bucket. keyFn(item) returns the bucket
+ * of an item, a number in [0, nBuckets). Afterwards the items of bucket b
+ * are at [offsets[b], offsets[b + 1]) of the vector, in their original
+ * order; the returned offsets have nBuckets + 1 entries. More than
+ * MaxFanout buckets are partitioned in several stable passes, a byte of the
+ * bucket number at a time, so that writes never spread over more than
+ * MaxFanout destinations.
+ *
+ * Throws std::out_of_range when keyFn returns a bucket out of range.
+ */
+const std::size_t MaxFanout = 256;
+
+template <typename Type, typename KeyFn>
+Vector<std::size_t> partition(Vector<Type> &items, KeyFn keyFn, std::size_t nBuckets);
+
+// partition on 'threads' threads, 0 means one per hardware thread
+template <typename Type, typename KeyFn>
+Vector<std::size_t> parallelPartition(Vector<Type> &items, KeyFn keyFn, std::size_t nBuckets, std::size_t threads = 0);
+
+/**
+ * @brief partitions items and folds every bucket from 'initial' with
+ *        combine(accumulator, item), returns one accumulator per bucket.
+ */
+template <typename Type, typename KeyFn, typename Accumulator, typename Combine>
+Vector<Accumulator> groupAggregate(Vector<Type> &items, KeyFn keyFn, std::size_t nBuckets,
+                                   const Accumulator &initial, Combine combine);
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_PARTITION_H
@@ -0,0 +1,84 @@
+#ifndef AISDI_LINEAR_REDUCED_FLOAT_VECTOR_H
+#define AISDI_LINEAR_REDUCED_FLOAT_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * 16 bit floating point formats. Conversions from float round to nearest
+ * even; NaN stays NaN. Float16 is IEEE half precision (5 bit exponent, 10
+ * bit mantissa, largest finite value 65504, larger values become infinity).
+ * BFloat16 keeps the float exponent and 7 bits of mantissa.
+ */
+struct Float16
+{
+  static std::uint16_t fromFloat(float value);
+  static float toFloat(std::uint16_t bits);
+  static void fromFloats(const float *in, std::uint16_t *out, std::size_t count);
+  static void toFloats(const std::uint16_t *in, float *out, std::size_t count);
+};
+
+struct BFloat16
+{
+  static std::uint16_t fromFloat(float value);
+  static float toFloat(std::uint16_t bits);
+  static void fromFloats(const float *in, std::uint16_t *out, std::size_t count);
+  static void toFloats(const std::uint16_t *in, float *out, std::size_t count);
+};
+
+/**
+ * @brief Vector of floats stored in a 16 bit Format, half the memory and
+ *        bandwidth of Vector<float>. Elements read back as float. sum and
+ *        dot decode a block at a time into a buffer that stays in L1 and
+ *        reduce it right away, so there is no separate decode pass.
+ */
+template <typename Format>
+class BasicReducedFloatVector
+{
+public:
+  using size_type = std::size_t;
+  using value_type = float;
+
+  BasicReducedFloatVector() {}
+  BasicReducedFloatVector(std::initializer_list<float> l);
+  explicit BasicReducedFloatVector(const Vector<float> &values);
+
+  float operator[](const size_type index) const;
+  void set(const size_type index, float value);
+
+  bool isEmpty() const { return _bits.isEmpty(); }
+  size_type getSize() const { return _bits.getSize(); }
+  const std::uint16_t *data() const { return _bits.data(); }
+
+  void append(float value);
+  void appendRange(const float *values, size_type count);
+
+  // all elements converted back, replacing the contents of out
+  void decode(Vector<float> &out) const;
+
+  float sum() const;
+  // throw std::invalid_argument when the sizes differ
+  float dot(const Vector<float> &other) const;
+  float dot(const BasicReducedFloatVector &other) const;
+
+private:
+  Vector<std::uint16_t> _bits;
+
+  static const size_type _block = 256;
+
+  template <typename Visit>
+  void forEachBlock(Visit visit) const;
+};
+
+using HalfVector = BasicReducedFloatVector<Float16>;
+using BF16Vector = BasicReducedFloatVector<BFloat16>;
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_REDUCED_FLOAT_VECTOR_H
@@ -0,0 +1,37 @@
+#ifndef AISDI_LINEAR_SCAN_H
+#define AISDI_LINEAR_SCAN_H
+
+#include <cstddef>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * Prefix sums. The inclusive scan turns [a, b, c] into [a, a+b, a+b+c],
+ * the exclusive one into [initial, initial+a, initial+a+b]. Overloads
+ * taking one vector work in place; the others overwrite out. The parallel
+ * versions run on 'threads' threads, 0 meaning one per hardware thread.
+ */
+template <typename Type>
+void inclusiveScan(Vector<Type> &values);
+
+template <typename Type>
+void inclusiveScan(const Vector<Type> &in, Vector<Type> &out);
+
+template <typename Type>
+void exclusiveScan(Vector<Type> &values, const Type &initial = Type());
+
+template <typename Type>
+void exclusiveScan(const Vector<Type> &in, Vector<Type> &out, const Type &initial = Type());
+
+template <typename Type>
+void parallelInclusiveScan(Vector<Type> &values, std::size_t threads = 0);
+
+template <typename Type>
+void parallelExclusiveScan(Vector<Type> &values, const Type &initial = Type(), std::size_t threads = 0);
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SCAN_H
@@ -0,0 +1,59 @@
+#ifndef AISDI_LINEAR_SEARCH_INDEX_H
+#define AISDI_LINEAR_SEARCH_INDEX_H
+
+#include <cstddef>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief read only search structure built from a sorted Vector. Keys are
+ *        stored in Eytzinger (breadth first) order, so the first levels of
+ *        every search share a few cache lines and the descendants of a
+ *        slot some levels down are contiguous. Each step prefetches one
+ *        cache line of them, as many levels down as a line holds (four
+ *        for 4-byte keys, three for 8-byte keys). Results are positions
+ *        in the sorted vector the index was built from.
+ */
+template <typename Type>
+class SearchIndex
+{
+public:
+  using size_type = std::size_t;
+  using value_type = Type;
+
+  SearchIndex() {}
+  // throws std::invalid_argument when sorted is not in ascending order
+  explicit SearchIndex(const Vector<Type> &sorted);
+
+  bool isEmpty() const { return getSize() == 0; }
+  size_type getSize() const { return _keys.isEmpty() ? 0 : _keys.getSize() - 1; }
+
+  // position of the first key not less than key, getSize() when there is none
+  size_type lowerBound(const Type &key) const;
+  bool contains(const Type &key) const;
+
+  /**
+   * @brief lowerBound of every key in keys, written to positions. Several
+   *        searches advance together so their cache misses overlap.
+   */
+  void lowerBounds(const Vector<Type> &keys, Vector<size_type> &positions) const;
+
+private:
+  Vector<Type> _keys;       // 1-based Eytzinger order, slot 0 unused
+  Vector<size_type> _ranks; // position in the sorted vector of every slot
+
+  // keys per cache line; for keys over 32 bytes only the slot itself
+  static const size_type _prefetchStride = 64 / sizeof(Type) > 0 ? 64 / sizeof(Type) : 1;
+  static const size_type _batch = 16;
+
+  size_type build(const Vector<Type> &sorted, size_type next, size_type slot);
+  size_type descend(const Type &key) const;
+  static size_type lastNotLess(size_type slot);
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SEARCH_INDEX_H
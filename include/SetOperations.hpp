@@ -0,0 +1,48 @@
+#ifndef AISDI_LINEAR_SET_OPERATIONS_H
+#define AISDI_LINEAR_SET_OPERATIONS_H
+
+#include <cstddef>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * Operations on sorted Vectors. setIntersect, setUnion and setDifference
+ * treat their inputs as sets, strictly increasing; merge accepts any sorted
+ * inputs and keeps duplicates, elements of a before equal elements of b.
+ * Results replace the contents of out, which must not be one of the inputs
+ * (std::invalid_argument). The count variants return the size the result
+ * would have without building it.
+ *
+ * When one input is much longer than the other, the elements of the short
+ * one are looked up in the long one by galloping search instead of walking
+ * both. Intersections of 32 bit integers of similar length compare four
+ * against four elements at a time with SSE2.
+ */
+template <typename Type>
+void setIntersect(const Vector<Type> &a, const Vector<Type> &b, Vector<Type> &out);
+
+template <typename Type>
+void setUnion(const Vector<Type> &a, const Vector<Type> &b, Vector<Type> &out);
+
+// elements of a that are not in b
+template <typename Type>
+void setDifference(const Vector<Type> &a, const Vector<Type> &b, Vector<Type> &out);
+
+template <typename Type>
+void merge(const Vector<Type> &a, const Vector<Type> &b, Vector<Type> &out);
+
+template <typename Type>
+std::size_t countIntersect(const Vector<Type> &a, const Vector<Type> &b);
+
+template <typename Type>
+std::size_t countUnion(const Vector<Type> &a, const Vector<Type> &b);
+
+template <typename Type>
+std::size_t countDifference(const Vector<Type> &a, const Vector<Type> &b);
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SET_OPERATIONS_H
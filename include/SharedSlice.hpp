@@ -0,0 +1,52 @@
+#ifndef AISDI_LINEAR_SHARED_SLICE_H
+#define AISDI_LINEAR_SHARED_SLICE_H
+
+#include <cstddef>
+#include <memory>
+
+#include "Span.hpp"
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief Range of a buffer taken over from a Vector. Slices of it share the
+ *        buffer through a reference count, it is freed with the last slice.
+ *        Slices may be handed to other threads; writing to overlapping
+ *        slices from several threads needs outside synchronisation.
+ */
+template <typename Type>
+class SharedSlice
+{
+public:
+  using size_type = std::size_t;
+  using value_type = Type;
+  using iterator = Type *;
+  using const_iterator = const Type *;
+
+  SharedSlice() : _data(nullptr), _size(0) {}
+  explicit SharedSlice(Vector<Type> &&vec);
+
+  Type &operator[](const size_type index) const;
+
+  bool isEmpty() const { return _size == 0; }
+  size_type getSize() const { return _size; }
+  Type *data() const { return _data; }
+  long getUseCount() const { return _owner.use_count(); }
+
+  SharedSlice slice(size_type from, size_type to) const;
+  Span<Type> span() const { return Span<Type>(_data, _size); }
+
+  iterator begin() const { return _data; }
+  iterator end() const { return _data + _size; }
+
+private:
+  std::shared_ptr<Type> _owner;
+  Type *_data;
+  size_type _size;
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SHARED_SLICE_H
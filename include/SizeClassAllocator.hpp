@@ -0,0 +1,245 @@
+#ifndef AISDI_LINEAR_SIZE_CLASS_ALLOCATOR_H
+#define AISDI_LINEAR_SIZE_CLASS_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+namespace aisdi
+{
+
+/**
+ * Caching allocator for small buffers, rounded up to power of two size
+ * classes that match the capacity doubling of Vector. Every thread keeps a
+ * free list per class and serves allocations from it without locking.
+ * Freed blocks go to the list of the freeing thread, whichever thread
+ * allocated them. When a list grows past two batches, one batch is handed
+ * to the shared list of the class. An empty list takes a whole batch back
+ * from the shared list. The shared lock is therefore taken once per batch,
+ * not once per call. Shared lists are refilled by carving spans from
+ * malloc. Spans are kept for the life of the process.
+ *
+ * Vector buffers use it when AISDI_VECTOR_USE_SIZE_CLASS_ALLOCATOR is
+ * defined, see VectorStorage.hpp.
+ */
+namespace pool
+{
+
+const std::size_t MinClassBytes = 16; // keeps blocks aligned like malloc
+const std::size_t MaxClassBytes = std::size_t(32) << 10;
+const std::size_t ClassCount = 12; // 16 B to 32 KiB
+const std::size_t SpanBytes = std::size_t(64) << 10;
+
+inline bool fits(std::size_t bytes) { return bytes <= MaxClassBytes; }
+
+inline std::size_t classOf(std::size_t bytes)
+{
+  if (bytes <= MinClassBytes)
+    return 0;
+  return (sizeof(unsigned long long) * 8 - __builtin_clzll(bytes - 1)) - 4;
+}
+
+inline std::size_t classBytes(std::size_t sizeClass) { return MinClassBytes << sizeClass; }
+
+// blocks moved between a thread and the shared list at once
+inline std::size_t batchSize(std::size_t sizeClass)
+{
+  std::size_t blocks = SpanBytes / 2 / classBytes(sizeClass);
+  return blocks < 2 ? 2 : blocks > 32 ? 32 : blocks;
+}
+
+namespace detail
+{
+
+struct FreeBlock
+{
+  FreeBlock *next;
+};
+
+struct SharedList
+{
+  std::mutex mutex;
+  FreeBlock *head = nullptr;
+  std::size_t count = 0;
+};
+
+// never destroyed, so buffers freed during static destruction still have
+// somewhere to go
+inline SharedList *sharedLists()
+{
+  static SharedList *lists = new SharedList[ClassCount];
+  return lists;
+}
+
+// trivially destructible, so it stays usable after the flusher below has run
+struct ThreadCache
+{
+  FreeBlock *heads[ClassCount];
+  std::size_t counts[ClassCount];
+  bool registered;
+  bool retired;
+};
+
+inline ThreadCache &threadCache()
+{
+  static thread_local ThreadCache cache = {};
+  return cache;
+}
+
+// moves up to 'count' blocks from the front of a list to the shared list
+inline void giveBack(std::size_t sizeClass, FreeBlock *&head, std::size_t &listCount, std::size_t count)
+{
+  if (count == 0)
+    return;
+
+  FreeBlock *first = head;
+  FreeBlock *last = head;
+  std::size_t moved = 1;
+  for (; moved < count && last->next != nullptr; ++moved)
+    last = last->next;
+  head = last->next;
+  listCount -= moved;
+
+  SharedList &shared = sharedLists()[sizeClass];
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  last->next = shared.head;
+  shared.head = first;
+  shared.count += moved;
+}
+
+// returns a whole thread cache to the shared lists when its thread exits
+struct CacheFlusher
+{
+  ~CacheFlusher()
+  {
+    ThreadCache &cache = threadCache();
+    for (std::size_t c = 0; c < ClassCount; ++c)
+      giveBack(c, cache.heads[c], cache.counts[c], cache.counts[c]);
+    cache.retired = true;
+  }
+};
+
+inline void registerFlusher(ThreadCache &cache)
+{
+  static thread_local CacheFlusher flusher;
+  (void)flusher;
+  cache.registered = true;
+}
+
+// splits a fresh span into blocks of the shared list, called under its lock
+inline void carveSpan(std::size_t sizeClass, SharedList &shared)
+{
+  std::size_t bytes = classBytes(sizeClass);
+  char *span = static_cast<char *>(std::malloc(SpanBytes));
+  if (span == nullptr)
+    throw std::bad_alloc();
+  for (std::size_t offset = 0; offset + bytes <= SpanBytes; offset += bytes)
+  {
+    FreeBlock *block = reinterpret_cast<FreeBlock *>(span + offset);
+    block->next = shared.head;
+    shared.head = block;
+    ++shared.count;
+  }
+}
+
+/**
+ * @brief takes a batch from the shared list, carving a new span when it
+ *        runs short, and pushes it on the thread list.
+ */
+inline void refill(std::size_t sizeClass, ThreadCache &cache)
+{
+  std::size_t wanted = batchSize(sizeClass);
+  SharedList &shared = sharedLists()[sizeClass];
+  std::lock_guard<std::mutex> lock(shared.mutex);
+
+  if (shared.count < wanted)
+    carveSpan(sizeClass, shared);
+
+  for (std::size_t taken = 0; taken < wanted; ++taken)
+  {
+    FreeBlock *block = shared.head;
+    shared.head = block->next;
+    block->next = cache.heads[sizeClass];
+    cache.heads[sizeClass] = block;
+  }
+  shared.count -= wanted;
+  cache.counts[sizeClass] += wanted;
+}
+
+// a single block straight from the shared list, for threads whose cache
+// was already flushed
+inline void *takeShared(std::size_t sizeClass)
+{
+  SharedList &shared = sharedLists()[sizeClass];
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  if (shared.head == nullptr)
+    carveSpan(sizeClass, shared);
+
+  FreeBlock *block = shared.head;
+  shared.head = block->next;
+  --shared.count;
+  return block;
+}
+
+} // namespace detail
+
+/**
+ * @brief returns a block of at least bytes, 1 <= bytes <= MaxClassBytes,
+ *        aligned like malloc.
+ */
+inline void *allocate(std::size_t bytes)
+{
+  std::size_t sizeClass = classOf(bytes);
+  detail::ThreadCache &cache = detail::threadCache();
+  if (!cache.registered)
+    detail::registerFlusher(cache);
+  // during thread exit nothing would flush a refilled cache again
+  if (cache.retired)
+    return detail::takeShared(sizeClass);
+
+  if (cache.heads[sizeClass] == nullptr)
+    detail::refill(sizeClass, cache);
+
+  detail::FreeBlock *block = cache.heads[sizeClass];
+  cache.heads[sizeClass] = block->next;
+  --cache.counts[sizeClass];
+  return block;
+}
+
+// bytes is any size that falls in the class the block was allocated with
+inline void deallocate(void *buffer, std::size_t bytes)
+{
+  std::size_t sizeClass = classOf(bytes);
+  detail::ThreadCache &cache = detail::threadCache();
+  // a thread that only frees still has to hand its cache back on exit
+  if (!cache.registered)
+    detail::registerFlusher(cache);
+  detail::FreeBlock *block = static_cast<detail::FreeBlock *>(buffer);
+  block->next = cache.heads[sizeClass];
+  cache.heads[sizeClass] = block;
+  ++cache.counts[sizeClass];
+
+  // after the thread's cache was flushed nothing would hand blocks back
+  if (cache.retired)
+    detail::giveBack(sizeClass, cache.heads[sizeClass], cache.counts[sizeClass], cache.counts[sizeClass]);
+  else if (cache.counts[sizeClass] > 2 * batchSize(sizeClass))
+    detail::giveBack(sizeClass, cache.heads[sizeClass], cache.counts[sizeClass], batchSize(sizeClass));
+}
+
+// blocks of sizeClass cached by the calling thread
+inline std::size_t getCachedBlocks(std::size_t sizeClass) { return detail::threadCache().counts[sizeClass]; }
+
+// blocks of sizeClass on the shared list
+inline std::size_t getSharedBlocks(std::size_t sizeClass)
+{
+  detail::SharedList &shared = detail::sharedLists()[sizeClass];
+  std::lock_guard<std::mutex> lock(shared.mutex);
+  return shared.count;
+}
+
+} // namespace pool
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SIZE_CLASS_ALLOCATOR_H
@@ -0,0 +1,86 @@
+#ifndef AISDI_LINEAR_SLOT_MAP_H
+#define AISDI_LINEAR_SLOT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief unordered container addressed by handles that stay valid while
+ *        other elements come and go. Values are kept densely packed for
+ *        iteration; a table of slots maps handles to their current position
+ *        and erase moves the last value into the hole. Every slot counts
+ *        its erasures, so a handle to an erased element is detected even
+ *        after its slot was reused. Insert, erase and lookup are O(1).
+ */
+template <typename Type>
+class SlotMap
+{
+public:
+  using size_type = std::size_t;
+  using value_type = Type;
+  using iterator = Type *;
+  using const_iterator = const Type *;
+
+  struct Handle
+  {
+    std::uint32_t index = UINT32_MAX;
+    std::uint32_t generation = 0;
+
+    bool operator==(const Handle &other) const { return index == other.index && generation == other.generation; }
+    bool operator!=(const Handle &other) const { return !(*this == other); }
+  };
+
+  SlotMap() : _freeHead(_endOfList) {}
+
+  // throws std::out_of_range for handles that are stale or never were valid
+  Type &operator[](const Handle &handle);
+  const Type &operator[](const Handle &handle) const;
+
+  // nullptr instead of throwing
+  Type *find(const Handle &handle);
+  const Type *find(const Handle &handle) const;
+  bool contains(const Handle &handle) const { return find(handle) != nullptr; }
+
+  bool isEmpty() const { return _values.isEmpty(); }
+  size_type getSize() const { return _values.getSize(); }
+
+  Handle insert(const Type &item);
+  void erase(const Handle &handle);
+  void clear();
+
+  // handle of the value at position of the dense storage, as iterated
+  Handle getHandle(size_type position) const;
+
+  iterator begin() { return _values.data(); }
+  iterator end() { return _values.data() + _values.getSize(); }
+  const_iterator cbegin() const { return _values.data(); }
+  const_iterator cend() const { return _values.data() + _values.getSize(); }
+  const_iterator begin() const { return cbegin(); }
+  const_iterator end() const { return cend(); }
+
+private:
+  struct Slot
+  {
+    std::uint32_t target;     // dense position when used, next free slot when free
+    std::uint32_t generation; // number of times the slot was erased
+  };
+
+  static const std::uint32_t _endOfList = UINT32_MAX;
+
+  Vector<Type> _values;
+  Vector<std::uint32_t> _owners; // slot of every dense value
+  Vector<Slot> _slots;
+  std::uint32_t _freeHead;
+
+  const Slot *findSlot(const Handle &handle) const;
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SLOT_MAP_H
@@ -0,0 +1,64 @@
+#ifndef AISDI_LINEAR_SPAN_H
+#define AISDI_LINEAR_SPAN_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace aisdi
+{
+
+/**
+ * @brief Non-owning view of a contiguous range of elements. Copying a span
+ *        copies two words; the elements must outlive it.
+ */
+template <typename Type>
+class Span
+{
+public:
+  using difference_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+  using value_type = typename std::remove_const<Type>::type;
+  using pointer = Type *;
+  using reference = Type &;
+  using iterator = Type *;
+  using const_iterator = const Type *;
+
+  Span() : _data(nullptr), _size(0) {}
+  Span(Type *data, size_type size) : _data(data), _size(size) {}
+
+  // Span<T> converts to Span<const T>
+  template <typename Other, typename = typename std::enable_if<std::is_convertible<Other (*)[], Type (*)[]>::value>::type>
+  Span(const Span<Other> &other) : _data(other.data()), _size(other.getSize()) {}
+
+  Type &operator[](const size_type index) const
+  {
+    if (index >= _size)
+      throw std::out_of_range("Index out of range");
+    return _data[index];
+  }
+
+  bool isEmpty() const { return _size == 0; }
+  size_type getSize() const { return _size; }
+  Type *data() const { return _data; }
+
+  Span slice(size_type from, size_type to) const
+  {
+    if (from > to || to > _size)
+      throw std::out_of_range("Slice out of range");
+    return Span(_data + from, to - from);
+  }
+
+  iterator begin() const { return _data; }
+  iterator end() const { return _data + _size; }
+  const_iterator cbegin() const { return _data; }
+  const_iterator cend() const { return _data + _size; }
+
+private:
+  Type *_data;
+  size_type _size;
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SPAN_H
@@ -0,0 +1,123 @@
+#ifndef AISDI_LINEAR_STRING_VECTOR_H
+#define AISDI_LINEAR_STRING_VECTOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <string_view>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief Vector of strings packed into one character buffer. String i is
+ *        the range [offsets[i], offsets[i + 1]) of the buffer, so a string
+ *        costs its characters plus one offset and scans never chase
+ *        pointers. Offset picks the offset width and so the buffer limit.
+ */
+template <typename Offset>
+class BasicStringVector
+{
+public:
+  using size_type = std::size_t;
+  using value_type = std::string_view;
+
+  class ConstIterator;
+  using const_iterator = ConstIterator;
+
+  BasicStringVector();
+  BasicStringVector(std::initializer_list<std::string_view> l);
+
+  std::string_view operator[](const size_type index) const;
+
+  bool isEmpty() const { return getSize() == 0; }
+  size_type getSize() const { return _offsets.getSize() - 1; }
+  size_type getCharCount() const { return _chars.getSize(); }
+  size_type getMemoryUsage() const;
+
+  void reserve(size_type strings, size_type chars);
+  void append(std::string_view item);
+  std::string_view popLast();
+  void clear();
+
+  // whole-column scans, comparing lengths first and characters with memcmp
+  size_type countEqual(std::string_view value) const;
+  void findEqual(std::string_view value, Vector<size_type> &out) const;
+  size_type countPrefix(std::string_view prefix) const;
+  void findPrefix(std::string_view prefix, Vector<size_type> &out) const;
+
+  const_iterator begin() const;
+  const_iterator end() const;
+  const_iterator cbegin() const { return begin(); }
+  const_iterator cend() const { return end(); }
+
+private:
+  Vector<char> _chars;
+  Vector<Offset> _offsets;
+
+  template <typename Match, typename Visit>
+  void scan(Match match, Visit visit) const;
+};
+
+template <typename Offset>
+class BasicStringVector<Offset>::ConstIterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::string_view;
+  using difference_type = std::ptrdiff_t;
+  using pointer = const std::string_view *;
+  using reference = std::string_view;
+
+  ConstIterator() : _vec(nullptr), _position(0) {}
+  ConstIterator(const BasicStringVector *vec, size_type position) : _vec(vec), _position(position) {}
+
+  std::string_view operator*() const { return (*_vec)[_position]; }
+
+  ConstIterator &operator++()
+  {
+    ++_position;
+    return *this;
+  }
+
+  ConstIterator operator++(int)
+  {
+    auto temp = *this;
+    ++_position;
+    return temp;
+  }
+
+  ConstIterator &operator--()
+  {
+    --_position;
+    return *this;
+  }
+
+  ConstIterator operator--(int)
+  {
+    auto temp = *this;
+    --_position;
+    return temp;
+  }
+
+  ConstIterator operator+(difference_type d) const { return ConstIterator(_vec, _position + d); }
+  ConstIterator operator-(difference_type d) const { return ConstIterator(_vec, _position - d); }
+  difference_type operator-(const ConstIterator &other) const { return _position - other._position; }
+
+  bool operator==(const ConstIterator &other) const { return _position == other._position; }
+  bool operator!=(const ConstIterator &other) const { return !(*this == other); }
+
+private:
+  const BasicStringVector *_vec;
+  size_type _position;
+};
+
+using StringVector = BasicStringVector<std::uint64_t>;
+using CompactStringVector = BasicStringVector<std::uint32_t>; // up to 4 GiB of characters
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_STRING_VECTOR_H
@@ -0,0 +1,264 @@
+#ifndef AISDI_LINEAR_TIERED_VECTOR_H
+#define AISDI_LINEAR_TIERED_VECTOR_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief Vector split into leaves plus an index of leaf start positions.
+ *        Leaf capacity follows sqrt(n): it doubles when the size passes its
+ *        square and halves when the size falls under a sixteenth of it, by
+ *        repacking all elements (amortised O(1) per edit). Leaves stay at
+ *        least about a quarter full, so there are O(sqrt(n)) of them and
+ *        insert and erase, which shift one leaf and update the index, are
+ *        O(sqrt(n)) instead of O(n); indexing is a binary search over
+ *        leaves. Iteration walks each leaf contiguously. The API matches
+ *        Vector.
+ */
+template <typename Type>
+class TieredVector
+{
+public:
+  using difference_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+  using value_type = Type;
+  using pointer = Type *;
+  using reference = Type &;
+  using const_pointer = const Type *;
+  using const_reference = const Type &;
+
+  class ConstIterator;
+  class Iterator;
+  using iterator = Iterator;
+  using const_iterator = ConstIterator;
+
+  // a page worth of elements, leaf capacity never goes below it
+  static const size_type MinLeafCapacity = 4096 / sizeof(Type) > 16 ? 4096 / sizeof(Type) : 16;
+
+  TieredVector() : _size(0), _leafCapacity(MinLeafCapacity) {}
+  TieredVector(std::initializer_list<Type> l);
+  TieredVector(const TieredVector &other);
+  TieredVector(TieredVector &&other);
+  ~TieredVector() { clear(); }
+
+  TieredVector &operator=(const TieredVector &other);
+  TieredVector &operator=(TieredVector &&other);
+  Type &operator[](const size_type index);
+  const Type &operator[](const size_type index) const;
+
+  bool isEmpty() const { return _size == 0; }
+  size_type getSize() const { return _size; }
+  size_type getCapacity() const { return _leaves.getSize() * _leafCapacity; }
+  size_type getLeafCount() const { return _leaves.getSize(); }
+  size_type getLeafCapacity() const { return _leafCapacity; }
+
+  void append(const Type &item);
+  void prepend(const Type &item);
+  void insert(const const_iterator &insertPosition, const Type &item);
+
+  Type popFirst();
+  Type popLast();
+
+  void erase(const const_iterator &possition);
+  void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded);
+
+  iterator begin() { return iterator(this, 0); }
+  iterator end() { return iterator(this, _size); }
+  const_iterator cbegin() const { return const_iterator(this, 0); }
+  const_iterator cend() const { return const_iterator(this, _size); }
+  const_iterator begin() const { return cbegin(); }
+  const_iterator end() const { return cend(); }
+
+private:
+  struct Leaf
+  {
+    Type *items; // _leafCapacity slots
+    size_type size;
+  };
+
+  Vector<Leaf *> _leaves;
+  Vector<size_type> _starts; // position of the first element of every leaf
+  size_type _size;
+  size_type _leafCapacity;
+
+  Leaf *newLeaf() const { return new Leaf{new Type[_leafCapacity], 0}; }
+  static void deleteLeaf(Leaf *leaf)
+  {
+    delete[] leaf->items;
+    delete leaf;
+  }
+
+  size_type findLeaf(size_type index) const;
+  void insertAt(size_type index, const Type &item);
+  void eraseAt(size_type index, size_type count);
+  void splitLeaf(size_type leaf);
+  void removeLeaf(size_type leaf);
+  void updateStartsFrom(size_type leaf);
+  void rebalance();
+  void repack(size_type leafCapacity);
+  void clear();
+};
+
+template <typename Type>
+class TieredVector<Type>::ConstIterator
+{
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = typename TieredVector::value_type;
+  using difference_type = typename TieredVector::difference_type;
+  using pointer = typename TieredVector::const_pointer;
+  using reference = typename TieredVector::const_reference;
+
+  explicit ConstIterator() : _vec(nullptr), _position(0), _leaf(0), _offset(0) {}
+  ConstIterator(const TieredVector<Type> *vec, size_type position) : _vec(vec), _position(position), _leaf(0), _offset(0)
+  {
+    if (position < vec->getSize())
+    {
+      _leaf = vec->findLeaf(position);
+      _offset = position - vec->_starts[_leaf];
+    }
+    else
+      _leaf = vec->_leaves.getSize();
+  }
+
+  reference operator*() const
+  {
+    if (_vec == nullptr || _position >= _vec->getSize())
+      throw std::out_of_range("Dereferencing end iterator");
+    return _vec->_leaves[_leaf]->items[_offset];
+  }
+
+  ConstIterator &operator++()
+  {
+    if (_vec == nullptr || _position >= _vec->getSize())
+      throw std::out_of_range("Incrementign end iterator");
+    ++_position;
+    if (++_offset == _vec->_leaves[_leaf]->size)
+    {
+      ++_leaf;
+      _offset = 0;
+    }
+    return *this;
+  }
+
+  ConstIterator operator++(int)
+  {
+    auto temp = *this;
+    ++*this;
+    return temp;
+  }
+
+  ConstIterator &operator--()
+  {
+    if (_position == 0)
+      throw std::out_of_range("Decrementing begin iterator");
+    --_position;
+    if (_offset == 0)
+      _offset = _vec->_leaves[--_leaf]->size;
+    --_offset;
+    return *this;
+  }
+
+  ConstIterator operator--(int)
+  {
+    auto temp = *this;
+    --*this;
+    return temp;
+  }
+
+  ConstIterator operator+(difference_type d) const
+  {
+    if (_vec == nullptr || _position + d > _vec->getSize())
+      throw std::out_of_range("Adding to iterator passed the end");
+    return ConstIterator(_vec, _position + d);
+  }
+
+  ConstIterator operator-(difference_type d) const
+  {
+    if (static_cast<difference_type>(_position) - d < 0)
+      throw std::out_of_range("Substracting iterator pass zero");
+    return ConstIterator(_vec, _position - d);
+  }
+
+  bool operator==(const ConstIterator &other) const
+  {
+    return _vec == other._vec && _position == other._position;
+  }
+
+  bool operator!=(const ConstIterator &other) const
+  {
+    return !(*this == other);
+  }
+
+  size_type getPosition() const { return _position; }
+
+protected:
+  const TieredVector<Type> *_vec;
+  size_type _position;
+  size_type _leaf;
+  size_type _offset;
+};
+
+template <typename Type>
+class TieredVector<Type>::Iterator : public TieredVector<Type>::ConstIterator
+{
+public:
+  using pointer = typename TieredVector::pointer;
+  using reference = typename TieredVector::reference;
+
+  explicit Iterator() : ConstIterator() {}
+  Iterator(TieredVector<Type> *vec, size_type position) : ConstIterator(vec, position) {}
+  Iterator(const ConstIterator &other) : ConstIterator(other) {}
+
+  Iterator &operator++()
+  {
+    ConstIterator::operator++();
+    return *this;
+  }
+
+  Iterator operator++(int)
+  {
+    auto result = *this;
+    ConstIterator::operator++();
+    return result;
+  }
+
+  Iterator &operator--()
+  {
+    ConstIterator::operator--();
+    return *this;
+  }
+
+  Iterator operator--(int)
+  {
+    auto result = *this;
+    ConstIterator::operator--();
+    return result;
+  }
+
+  Iterator operator+(difference_type d) const
+  {
+    return ConstIterator::operator+(d);
+  }
+
+  Iterator operator-(difference_type d) const
+  {
+    return ConstIterator::operator-(d);
+  }
+
+  reference operator*() const
+  {
+    return const_cast<reference>(ConstIterator::operator*());
+  }
+};
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_TIERED_VECTOR_H
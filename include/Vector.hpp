@@ -2,10 +2,16 @@
 #define AISDI_LINEAR_VECTOR_H
 
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
 #include <stdexcept>
+#include <type_traits>
 #include <iostream>
 
+#include "Span.hpp"
+#include "VectorAccounting.hpp"
+#include "VectorStorage.hpp"
+
 namespace aisdi
 {
 
@@ -23,28 +29,59 @@ public:
 
   class ConstIterator;
   class Iterator;
+  class EditBatch;
   using iterator = Iterator;
   using const_iterator = ConstIterator;
 
+  // frees a buffer holding 'capacity' elements
+  using Deleter = void (*)(Type *buffer, size_type capacity);
+
+  // buffer handed out by release(), the owner frees it with deleter
+  struct Buffer
+  {
+    Type *data;
+    size_type size;
+    size_type capacity;
+    Deleter deleter;
+  };
+
   Vector();
+  explicit Vector(size_type count);
+  Vector(size_type count, const Type &value);
   Vector(std::initializer_list<Type> l);
   Vector(const Vector &other);
   Vector(Vector &&other);
-  ~Vector()
-  {
-    if (_array)
-      delete[] _array;
-  }
+  ~Vector() { releaseArray(); }
 
   Vector &operator=(const Vector &other);
   Vector &operator=(Vector &&other);
   Type &operator[](const size_type index);
+  const Type &operator[](const size_type index) const;
 
   bool isEmpty() const { return _size == 0; }
   size_type getSize() const { return _size; }
   size_type getCapacity() const { return _capacity; }
+  Type *data() { return _array; }
+  const Type *data() const { return _array; }
+
+  Span<Type> slice(size_type from, size_type to);
+  Span<const Type> slice(size_type from, size_type to) const;
+
+  void reserve(size_type capacity);
+  void resize(size_type size);
+  void resize(size_type size, const Type &value);
+  void resizeDefaultInit(size_type size);
+
+  void adopt(Type *buffer, size_type size, size_type capacity, Deleter deleter);
+  Buffer release();
+
+  // attributes the buffer to tag in the accounting totals, see VectorAccounting.hpp
+  void setTag(accounting::Tag tag);
+  accounting::Tag getTag() const;
 
   void append(const Type &item);
+  void append(Vector &&other);
+  void appendRange(const Type *items, size_type count);
   void prepend(const Type &item);
   void insert(const const_iterator &insertPosition, const Type &item);
 
@@ -54,6 +91,10 @@ public:
   void erase(const const_iterator &possition);
   void erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded);
 
+  // collects inserts and erases against the current positions and applies
+  // them together on commit, see EditBatch
+  EditBatch beginEdit() { return EditBatch(this); }
+
   // iterator begin()              {return _size > 0 ? iterator(&(_array[0])) : iterator();}
   // iterator end()                {return _size > 0 ? iterator(&_array[_size]) : iterator();}
   // const_iterator cbegin() const {return _size > 0 ? const_iterator(&_array[0]) : const_iterator();}
@@ -69,10 +110,37 @@ private:
   Type *_array;
   size_type _capacity;
   size_type _size;
+  storage::Kind _storage;
+#ifdef AISDI_VECTOR_ACCOUNTING
+  accounting::Tag _tag = accounting::Untagged; // fits in the padding after _storage
+#endif
+  std::uint32_t _modifications = 0; // changes of size or buffer, checked by EditBatch
+  Deleter _deleter = nullptr; // only for adopted buffers
+#ifdef AISDI_VECTOR_ACCOUNTING
+  size_type _accountedSlack = 0; // slack currently reported for the buffer
+#endif
 
   static const size_type _defaultCapacity = 8;
 
+  // trivial types live in malloc/mmap buffers that can grow in place
+  static const bool _isRelocatable = std::is_trivial<Type>::value;
+
+  static Type *allocateArray(size_type capacity, storage::Kind &kind);
+  void releaseArray();
+  void takeBuffer(Vector &other);
+  void sizeChanged();
+  void accountAcquire();
+  void accountSize();
+  void accountRelease();
+
+  static void deleteArray(Type *buffer, size_type) { delete[] buffer; }
+  static void freeHeap(Type *buffer, size_type) { std::free(buffer); }
+  static void unmapBuffer(Type *buffer, size_type capacity) { munmap(buffer, storage::mappedLength(capacity * sizeof(Type))); }
+  static void freePooled(Type *buffer, size_type capacity) { pool::deallocate(buffer, capacity * sizeof(Type)); }
+
   void changeCapacityBy(float);
+  void changeCapacityTo(size_type);
+  void growFor(size_type);
   void moveElementsRight(int from, int jump = 1);
   void moveElementsLeft(int from, int jump = 1);
 };
@@ -237,6 +305,54 @@ public:
   }
 };
 
+/**
+ * @brief pending inserts and erases for one Vector. Positions refer to the
+ *        vector as it was when the batch was started, so edits can be
+ *        recorded in any order; inserts at the same position keep the order
+ *        they were recorded in and go before the element at that position.
+ *        Any change of the vector's size or buffer after beginEdit, other
+ *        than through the batch, invalidates it and commit() throws.
+ *        commit() sorts the edits and moves every element at most once,
+ *        O(n + k log k) instead of O(k n) for k separate calls, and only
+ *        reallocates when the result does not fit the capacity.
+ */
+template <typename Type>
+class Vector<Type>::EditBatch
+{
+public:
+  explicit EditBatch(Vector<Type> *vec)
+      : _vec(vec), _originalSize(vec->getSize()), _modifications(vec->_modifications) {}
+
+  void insertAt(size_type position, const Type &item);
+  void eraseAt(size_type position);
+
+  bool isEmpty() const { return _insertions.isEmpty() && _erasures.isEmpty(); }
+  size_type getEditCount() const { return _insertions.getSize() + _erasures.getSize(); }
+
+  void commit();
+
+private:
+  struct Insertion
+  {
+    size_type position; // before commit in the old vector, then in the new one
+    Type item;
+  };
+
+  // original elements [from, to) that all move by shift
+  struct Run
+  {
+    size_type from;
+    size_type to;
+    difference_type shift;
+  };
+
+  Vector<Type> *_vec;
+  size_type _originalSize;
+  std::uint32_t _modifications; // the vector's count when the batch was started
+  Vector<Insertion> _insertions;
+  Vector<size_type> _erasures;
+};
+
 } // namespace aisdi
 
 #endif // AISDI_LINEAR_VECTOR_H
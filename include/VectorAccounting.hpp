@@ -0,0 +1,242 @@
+#ifndef AISDI_LINEAR_VECTOR_ACCOUNTING_H
+#define AISDI_LINEAR_VECTOR_ACCOUNTING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+
+namespace aisdi
+{
+
+/**
+ * Process wide accounting of the buffers held by Vectors, compiled in when
+ * AISDI_VECTOR_ACCOUNTING is defined; without it the hooks vanish and all
+ * totals stay zero. It is set with FEATURES in the Makefile. Every
+ * allocation, resize and release of a buffer updates totals for all
+ * Vectors, for the element type and for the Vector's tag. Slack is the
+ * capacity beyond the vector's size; it is updated whenever the size
+ * changes, so unlike live bytes it costs atomic updates on appends and
+ * pops.
+ *
+ * A soft budget calls a callback on the thread whose allocation pushed the
+ * live total over it, once per crossing. The callback may free memory, but
+ * must not throw; exceptions from it are dropped.
+ */
+namespace accounting
+{
+
+using Tag = std::uint16_t;
+const Tag Untagged = 0;
+const std::size_t MaxTags = 256;
+
+struct Usage
+{
+  std::size_t liveBytes;  // capacity of all buffers
+  std::size_t slackBytes; // part of liveBytes past the size
+  std::size_t buffers;
+};
+
+using BudgetCallback = std::function<void(std::size_t liveBytes)>;
+
+namespace detail
+{
+
+struct Counters
+{
+  std::atomic<std::size_t> liveBytes{0};
+  std::atomic<std::size_t> slackBytes{0};
+  std::atomic<std::size_t> buffers{0};
+
+  Usage load() const { return Usage{liveBytes.load(), slackBytes.load(), buffers.load()}; }
+};
+
+struct TypeEntry
+{
+  const char *name;
+  Counters counters;
+  TypeEntry *next;
+};
+
+struct Registry
+{
+  Counters total;
+  Counters tags[MaxTags];
+  std::string tagNames[MaxTags];
+  std::size_t tagCount = 1; // the untagged tag
+  std::atomic<TypeEntry *> types{nullptr};
+  std::atomic<std::size_t> softBudget{0};
+  BudgetCallback callback;
+  std::mutex mutex;
+};
+
+inline Registry &registry()
+{
+  static Registry instance;
+  return instance;
+}
+
+// counters of one element type, linked into the registry on first use
+template <typename Type>
+TypeEntry &typeEntry()
+{
+  static TypeEntry *entry = [] {
+    TypeEntry *created = new TypeEntry{typeid(Type).name(), {}, nullptr};
+    Registry &r = registry();
+    created->next = r.types.load();
+    while (!r.types.compare_exchange_weak(created->next, created))
+      ;
+    return created;
+  }();
+  return *entry;
+}
+
+inline void fireBudget(std::size_t liveBytes)
+{
+  static thread_local bool running = false;
+  if (running)
+    return;
+
+  BudgetCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(registry().mutex);
+    callback = registry().callback;
+  }
+  if (!callback)
+    return;
+
+  running = true;
+  try
+  {
+    callback(liveBytes);
+  }
+  catch (...)
+  {
+  }
+  running = false;
+}
+
+inline void add(Counters &counters, std::size_t bytes, std::size_t slack)
+{
+  counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed);
+  counters.slackBytes.fetch_add(slack, std::memory_order_relaxed);
+  counters.buffers.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline void subtract(Counters &counters, std::size_t bytes, std::size_t slack)
+{
+  counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+  counters.slackBytes.fetch_sub(slack, std::memory_order_relaxed);
+  counters.buffers.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template <typename Type>
+void acquire(Tag tag, std::size_t bytes, std::size_t slack)
+{
+  Registry &r = registry();
+  add(typeEntry<Type>().counters, bytes, slack);
+  add(r.tags[tag], bytes, slack);
+
+  std::size_t before = r.total.liveBytes.fetch_add(bytes, std::memory_order_relaxed);
+  r.total.slackBytes.fetch_add(slack, std::memory_order_relaxed);
+  r.total.buffers.fetch_add(1, std::memory_order_relaxed);
+
+  std::size_t budget = r.softBudget.load(std::memory_order_relaxed);
+  if (budget != 0 && before <= budget && before + bytes > budget)
+    fireBudget(before + bytes);
+}
+
+// a buffer's slack changed with the size; to - from wraps around when
+// slack shrinks, which unsigned addition turns into the subtraction
+template <typename Type>
+void adjustSlack(Tag tag, std::size_t from, std::size_t to)
+{
+  typeEntry<Type>().counters.slackBytes.fetch_add(to - from, std::memory_order_relaxed);
+  registry().tags[tag].slackBytes.fetch_add(to - from, std::memory_order_relaxed);
+  registry().total.slackBytes.fetch_add(to - from, std::memory_order_relaxed);
+}
+
+// attributes a buffer to another tag; totals of the type and overall stay
+inline void retag(Tag from, Tag to, std::size_t bytes, std::size_t slack)
+{
+  subtract(registry().tags[from], bytes, slack);
+  add(registry().tags[to], bytes, slack);
+}
+
+template <typename Type>
+void release(Tag tag, std::size_t bytes, std::size_t slack)
+{
+  subtract(typeEntry<Type>().counters, bytes, slack);
+  subtract(registry().tags[tag], bytes, slack);
+  subtract(registry().total, bytes, slack);
+}
+
+} // namespace detail
+
+/**
+ * @brief returns the tag registered under name, registering it first if
+ *        needed. Throws std::length_error when all MaxTags are taken.
+ */
+inline Tag registerTag(const std::string &name)
+{
+  detail::Registry &r = detail::registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  for (std::size_t tag = 1; tag < r.tagCount; ++tag)
+    if (r.tagNames[tag] == name)
+      return static_cast<Tag>(tag);
+
+  if (r.tagCount == MaxTags)
+    throw std::length_error("Too many accounting tags");
+  r.tagNames[r.tagCount] = name;
+  return static_cast<Tag>(r.tagCount++);
+}
+
+inline std::string getTagName(Tag tag)
+{
+  detail::Registry &r = detail::registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  if (tag >= r.tagCount)
+    throw std::out_of_range("Unknown accounting tag");
+  return r.tagNames[tag];
+}
+
+inline Usage getUsage() { return detail::registry().total.load(); }
+
+inline Usage getTagUsage(Tag tag)
+{
+  if (tag >= MaxTags)
+    throw std::out_of_range("Unknown accounting tag");
+  return detail::registry().tags[tag].load();
+}
+
+template <typename Type>
+Usage getTypeUsage() { return detail::typeEntry<Type>().counters.load(); }
+
+// visit(typeName, usage) for every element type that was ever allocated
+template <typename Visit>
+void forEachType(Visit visit)
+{
+  for (detail::TypeEntry *entry = detail::registry().types.load(); entry != nullptr; entry = entry->next)
+    visit(entry->name, entry->counters.load());
+}
+
+// a budget of 0 turns it off
+inline void setSoftBudget(std::size_t bytes, BudgetCallback callback)
+{
+  detail::Registry &r = detail::registry();
+  std::lock_guard<std::mutex> lock(r.mutex);
+  r.callback = callback;
+  r.softBudget = bytes;
+}
+
+inline std::size_t getSoftBudget() { return detail::registry().softBudget; }
+
+} // namespace accounting
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VECTOR_ACCOUNTING_H
@@ -0,0 +1,85 @@
+#ifndef AISDI_LINEAR_VECTOR_IO_H
+#define AISDI_LINEAR_VECTOR_IO_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+namespace io
+{
+
+enum class Format
+{
+  Text,  // numbers separated by whitespace, usually one per line
+  Binary // raw sizeof(Type) records in host byte order
+};
+
+struct ReadOptions
+{
+  std::size_t chunkSize = 1 << 20;
+  bool backgroundReader = false; // read the next chunk while parsing the current one
+};
+
+/**
+ * @brief reads the whole descriptor into out, appending every parsed item.
+ *        Throws std::system_error on read errors and std::invalid_argument
+ *        on malformed text or a trailing partial binary record. When it
+ *        throws, out keeps only the items it had before the call.
+ *
+ * @return number of items appended
+ */
+template <typename Type>
+std::size_t readInto(Vector<Type> &out, int fd, Format format, const ReadOptions &options = ReadOptions());
+
+namespace detail
+{
+
+/**
+ * Reads a descriptor in page aligned chunks of a fixed size. With a
+ * background reader two buffers are used: one is handed to the caller while
+ * the thread fills the other one.
+ */
+class ChunkReader
+{
+public:
+  using size_type = std::size_t;
+
+  ChunkReader(int fd, size_type chunkSize, bool background);
+  ChunkReader(const ChunkReader &) = delete;
+  ChunkReader &operator=(const ChunkReader &) = delete;
+  ~ChunkReader();
+
+  // points data at the next chunk, valid until the following call;
+  // returns its length, 0 at end of input
+  size_type next(const char *&data);
+
+private:
+  int _fd;
+  size_type _chunkSize;
+  char *_buffers[2];
+  size_type _lengths[2];
+  bool _ready[2];
+  int _current;
+  bool _finished;
+  bool _stopping;
+  std::exception_ptr _error;
+  std::mutex _mutex;
+  std::condition_variable _changed;
+  std::thread _reader;
+
+  size_type fill(char *buffer);
+  void readAhead();
+};
+
+} // namespace detail
+
+} // namespace io
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VECTOR_IO_H
@@ -0,0 +1,195 @@
+#ifndef AISDI_LINEAR_VECTOR_STORAGE_H
+#define AISDI_LINEAR_VECTOR_STORAGE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "SizeClassAllocator.hpp"
+
+namespace aisdi
+{
+
+/**
+ * Raw buffers used by Vector for trivial element types. Small buffers come
+ * from malloc and grow with realloc; buffers of at least remapThreshold
+ * bytes are private anonymous mappings grown with mremap, so the kernel
+ * moves page table entries instead of copying the data.
+ *
+ * With AISDI_VECTOR_USE_SIZE_CLASS_ALLOCATOR defined, buffers of up to
+ * pool::MaxClassBytes come from the thread caching allocator in
+ * SizeClassAllocator.hpp instead of malloc. It is set with FEATURES in
+ * the Makefile.
+ */
+namespace storage
+{
+
+enum class Kind : unsigned char
+{
+  None,   // no buffer
+  Array,  // new[] / delete[]
+  Heap,   // malloc / realloc / free
+  Mapped, // mmap / mremap / munmap
+  Adopted, // freed by a deleter supplied with the buffer
+  Pooled   // pool::allocate / pool::deallocate
+};
+
+inline std::atomic<std::size_t> &remapThresholdBytes()
+{
+  static std::atomic<std::size_t> threshold(std::size_t(4) << 20);
+  return threshold;
+}
+
+inline void setRemapThreshold(std::size_t bytes) { remapThresholdBytes() = bytes; }
+inline std::size_t getRemapThreshold() { return remapThresholdBytes(); }
+
+inline std::size_t mappedLength(std::size_t bytes)
+{
+  static const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return (bytes + page - 1) / page * page;
+}
+
+inline void *map(std::size_t bytes)
+{
+  void *buffer = mmap(nullptr, mappedLength(bytes), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (buffer == MAP_FAILED)
+    throw std::bad_alloc();
+  return buffer;
+}
+
+inline void *allocate(std::size_t bytes, Kind &kind)
+{
+  if (bytes == 0)
+  {
+    kind = Kind::None;
+    return nullptr;
+  }
+  if (bytes >= getRemapThreshold())
+  {
+    kind = Kind::Mapped;
+    return map(bytes);
+  }
+#ifdef AISDI_VECTOR_USE_SIZE_CLASS_ALLOCATOR
+  if (pool::fits(bytes))
+  {
+    kind = Kind::Pooled;
+    return pool::allocate(bytes);
+  }
+#endif
+
+  void *buffer = std::malloc(bytes);
+  if (buffer == nullptr)
+    throw std::bad_alloc();
+  kind = Kind::Heap;
+  return buffer;
+}
+
+// like allocate, but the buffer reads as zeros; fresh pages from calloc or
+// mmap are zeroed lazily by the kernel on first touch
+inline void *allocateZeroed(std::size_t bytes, Kind &kind)
+{
+  if (bytes == 0)
+  {
+    kind = Kind::None;
+    return nullptr;
+  }
+  if (bytes >= getRemapThreshold())
+  {
+    kind = Kind::Mapped;
+    return map(bytes);
+  }
+#ifdef AISDI_VECTOR_USE_SIZE_CLASS_ALLOCATOR
+  if (pool::fits(bytes))
+  {
+    kind = Kind::Pooled;
+    return std::memset(pool::allocate(bytes), 0, bytes);
+  }
+#endif
+
+  void *buffer = std::calloc(1, bytes);
+  if (buffer == nullptr)
+    throw std::bad_alloc();
+  kind = Kind::Heap;
+  return buffer;
+}
+
+inline void deallocate(void *buffer, std::size_t bytes, Kind kind)
+{
+  if (kind == Kind::Mapped)
+    munmap(buffer, mappedLength(bytes));
+  else if (kind == Kind::Heap)
+    std::free(buffer);
+  else if (kind == Kind::Pooled)
+    pool::deallocate(buffer, bytes);
+}
+
+/**
+ * @brief resizes a buffer from allocate keeping its first usedBytes. Moves
+ *        between malloc and mappings when newBytes crosses the threshold;
+ *        on failure the old buffer is left untouched.
+ */
+inline void *reallocate(void *buffer, std::size_t oldBytes, std::size_t newBytes, std::size_t usedBytes, Kind &kind)
+{
+  if (kind == Kind::None)
+    return allocate(newBytes, kind);
+
+  if (kind == Kind::Pooled)
+  {
+    // the block already has room up to the end of its size class
+    if (pool::fits(newBytes) && pool::classOf(newBytes) == pool::classOf(oldBytes))
+      return buffer;
+
+    Kind movedKind;
+    void *moved = allocate(newBytes, movedKind);
+    std::memcpy(moved, buffer, usedBytes);
+    deallocate(buffer, oldBytes, kind);
+    kind = movedKind;
+    return moved;
+  }
+
+  if (newBytes >= getRemapThreshold())
+  {
+    if (kind == Kind::Mapped)
+    {
+#ifdef MREMAP_MAYMOVE
+      void *moved = mremap(buffer, mappedLength(oldBytes), mappedLength(newBytes), MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED)
+        throw std::bad_alloc();
+      return moved;
+#endif
+    }
+
+    void *mapped = map(newBytes);
+    std::memcpy(mapped, buffer, usedBytes);
+    deallocate(buffer, oldBytes, kind);
+    kind = Kind::Mapped;
+    return mapped;
+  }
+
+  if (kind == Kind::Mapped)
+  {
+    void *heap = std::malloc(newBytes);
+    if (heap == nullptr)
+      throw std::bad_alloc();
+    std::memcpy(heap, buffer, usedBytes);
+    deallocate(buffer, oldBytes, kind);
+    kind = Kind::Heap;
+    return heap;
+  }
+
+  void *resized = std::realloc(buffer, newBytes);
+  if (resized == nullptr)
+    throw std::bad_alloc();
+  return resized;
+}
+
+} // namespace storage
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VECTOR_STORAGE_H
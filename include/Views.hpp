@@ -0,0 +1,355 @@
+#ifndef AISDI_LINEAR_VIEWS_H
+#define AISDI_LINEAR_VIEWS_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "Vector.hpp"
+
+namespace aisdi
+{
+
+/**
+ * Lazy views over Vector. A view does not own or copy elements, it only
+ * describes how to produce them. Every view pushes its elements into a
+ * sink with forEach(sink); the sink returns false to stop early. Nested
+ * views inline into one loop, so a whole pipeline walks memory once.
+ *
+ * Views that know their size up front (isSized) and can produce any element
+ * by index (at) are random access; filter is neither.
+ *
+ *   collectInto(views::transform(views::filter(v, isOdd), square), out);
+ *   collectInto(v | views::filter(isOdd) | views::transform(square), out);
+ */
+namespace views
+{
+
+template <typename Type>
+class VectorView
+{
+public:
+  using size_type = std::size_t;
+  using value_type = Type;
+
+  static const bool isRandomAccess = true;
+
+  explicit VectorView(const Vector<Type> &vec) : _data(vec.data()), _size(vec.getSize()) {}
+
+  bool isSized() const { return true; }
+  size_type getSize() const { return _size; }
+  const Type &at(size_type index) const { return _data[index]; }
+
+  template <typename Sink>
+  bool forEach(Sink &&sink) const
+  {
+    for (size_type i = 0; i < _size; ++i)
+      if (!sink(_data[i]))
+        return false;
+    return true;
+  }
+
+private:
+  const Type *_data;
+  size_type _size;
+};
+
+template <typename Source, typename Function>
+class TransformView
+{
+public:
+  using size_type = std::size_t;
+  using value_type = typename std::decay<decltype(std::declval<const Function &>()(
+      std::declval<const typename Source::value_type &>()))>::type;
+
+  static const bool isRandomAccess = Source::isRandomAccess;
+
+  TransformView(Source source, Function function) : _source(source), _function(function) {}
+
+  bool isSized() const { return _source.isSized(); }
+  size_type getSize() const { return _source.getSize(); }
+  value_type at(size_type index) const { return _function(_source.at(index)); }
+
+  template <typename Sink>
+  bool forEach(Sink &&sink) const
+  {
+    return _source.forEach([&](const typename Source::value_type &item) { return sink(_function(item)); });
+  }
+
+private:
+  Source _source;
+  Function _function;
+};
+
+template <typename Source, typename Predicate>
+class FilterView
+{
+public:
+  using size_type = std::size_t;
+  using value_type = typename Source::value_type;
+
+  static const bool isRandomAccess = false;
+
+  FilterView(Source source, Predicate predicate) : _source(source), _predicate(predicate) {}
+
+  bool isSized() const { return false; }
+  size_type getSize() const { throw std::logic_error("Size of filtered view is unknown"); }
+
+  template <typename Sink>
+  bool forEach(Sink &&sink) const
+  {
+    return _source.forEach([&](const value_type &item) { return !_predicate(item) || sink(item); });
+  }
+
+private:
+  Source _source;
+  Predicate _predicate;
+};
+
+// elements [from, to) of the source taken every 'step' elements
+template <typename Source>
+class SliceView
+{
+public:
+  using size_type = std::size_t;
+  using value_type = typename Source::value_type;
+
+  static const bool isRandomAccess = Source::isRandomAccess;
+
+  SliceView(Source source, size_type from, size_type to, size_type step = 1)
+      : _source(source), _from(from), _to(to), _step(step)
+  {
+    if (from > to)
+      throw std::out_of_range("Slice begins after its end");
+    if (step == 0)
+      throw std::invalid_argument("Stride must be positive");
+    if (_source.isSized() && _source.getSize() < _to)
+      _to = _source.getSize();
+    if (_from > _to)
+      _from = _to;
+  }
+
+  bool isSized() const { return _source.isSized(); }
+  size_type getSize() const { return (_to - _from + _step - 1) / _step; }
+  decltype(std::declval<const Source &>().at(0)) at(size_type index) const { return _source.at(_from + index * _step); }
+
+  template <typename Sink>
+  bool forEach(Sink &&sink) const
+  {
+    return forEach(std::forward<Sink>(sink), std::integral_constant<bool, Source::isRandomAccess>());
+  }
+
+private:
+  Source _source;
+  size_type _from;
+  size_type _to;
+  size_type _step;
+
+  template <typename Sink>
+  bool forEach(Sink &&sink, std::true_type) const
+  {
+    for (size_type i = _from; i < _to; i += _step)
+      if (!sink(_source.at(i)))
+        return false;
+    return true;
+  }
+
+  template <typename Sink>
+  bool forEach(Sink &&sink, std::false_type) const
+  {
+    size_type position = 0;
+    bool stopped = false;
+    _source.forEach([&](const value_type &item) {
+      if (position >= _to)
+        return false;
+      if (position >= _from && (position - _from) % _step == 0 && !sink(item))
+      {
+        stopped = true;
+        return false;
+      }
+      ++position;
+      return true;
+    });
+    return !stopped;
+  }
+};
+
+template <typename First, typename Second>
+class ZipView
+{
+public:
+  using size_type = std::size_t;
+  using value_type = std::pair<typename First::value_type, typename Second::value_type>;
+
+  static_assert(First::isRandomAccess && Second::isRandomAccess, "zip needs random access views");
+  static const bool isRandomAccess = true;
+
+  ZipView(First first, Second second) : _first(first), _second(second) {}
+
+  bool isSized() const { return true; }
+  size_type getSize() const
+  {
+    return _first.getSize() < _second.getSize() ? _first.getSize() : _second.getSize();
+  }
+  value_type at(size_type index) const { return value_type(_first.at(index), _second.at(index)); }
+
+  template <typename Sink>
+  bool forEach(Sink &&sink) const
+  {
+    size_type size = getSize();
+    for (size_type i = 0; i < size; ++i)
+      if (!sink(at(i)))
+        return false;
+    return true;
+  }
+
+private:
+  First _first;
+  Second _second;
+};
+
+template <typename Source>
+class EnumerateView
+{
+public:
+  using size_type = std::size_t;
+  using value_type = std::pair<size_type, typename Source::value_type>;
+
+  static const bool isRandomAccess = Source::isRandomAccess;
+
+  explicit EnumerateView(Source source) : _source(source) {}
+
+  bool isSized() const { return _source.isSized(); }
+  size_type getSize() const { return _source.getSize(); }
+  value_type at(size_type index) const { return value_type(index, _source.at(index)); }
+
+  template <typename Sink>
+  bool forEach(Sink &&sink) const
+  {
+    size_type index = 0;
+    return _source.forEach([&](const typename Source::value_type &item) { return sink(value_type(index++, item)); });
+  }
+
+private:
+  Source _source;
+};
+
+// turns a Vector into a view and leaves views untouched
+template <typename Type>
+VectorView<Type> all(const Vector<Type> &vec) { return VectorView<Type>(vec); }
+
+template <typename View>
+const View &all(const View &view) { return view; }
+
+template <typename Source>
+using ViewOf = typename std::decay<decltype(all(std::declval<const Source &>()))>::type;
+
+template <typename Source, typename Function>
+TransformView<ViewOf<Source>, Function> transform(const Source &source, Function function)
+{
+  return TransformView<ViewOf<Source>, Function>(all(source), function);
+}
+
+template <typename Source, typename Predicate>
+FilterView<ViewOf<Source>, Predicate> filter(const Source &source, Predicate predicate)
+{
+  return FilterView<ViewOf<Source>, Predicate>(all(source), predicate);
+}
+
+template <typename Source>
+SliceView<ViewOf<Source>> slice(const Source &source, std::size_t from, std::size_t to)
+{
+  return SliceView<ViewOf<Source>>(all(source), from, to);
+}
+
+template <typename Source>
+SliceView<ViewOf<Source>> take(const Source &source, std::size_t count)
+{
+  return SliceView<ViewOf<Source>>(all(source), 0, count);
+}
+
+template <typename Source>
+SliceView<ViewOf<Source>> stride(const Source &source, std::size_t step)
+{
+  return SliceView<ViewOf<Source>>(all(source), 0, static_cast<std::size_t>(-1), step);
+}
+
+template <typename First, typename Second>
+ZipView<ViewOf<First>, ViewOf<Second>> zip(const First &first, const Second &second)
+{
+  return ZipView<ViewOf<First>, ViewOf<Second>>(all(first), all(second));
+}
+
+template <typename Source>
+EnumerateView<ViewOf<Source>> enumerate(const Source &source)
+{
+  return EnumerateView<ViewOf<Source>>(all(source));
+}
+
+// partially applied view used with operator|, e.g. v | views::take(10)
+template <typename Factory>
+class Adaptor
+{
+public:
+  explicit Adaptor(Factory factory) : _factory(factory) {}
+
+  template <typename Source>
+  auto operator()(const Source &source) const -> decltype(std::declval<const Factory &>()(source))
+  {
+    return _factory(source);
+  }
+
+private:
+  Factory _factory;
+};
+
+template <typename Factory>
+Adaptor<Factory> makeAdaptor(Factory factory) { return Adaptor<Factory>(factory); }
+
+template <typename Function>
+auto transform(Function function)
+{
+  return makeAdaptor([function](const auto &source) { return transform(source, function); });
+}
+
+template <typename Predicate>
+auto filter(Predicate predicate)
+{
+  return makeAdaptor([predicate](const auto &source) { return filter(source, predicate); });
+}
+
+inline auto slice(std::size_t from, std::size_t to)
+{
+  return makeAdaptor([from, to](const auto &source) { return slice(source, from, to); });
+}
+
+inline auto take(std::size_t count)
+{
+  return makeAdaptor([count](const auto &source) { return take(source, count); });
+}
+
+inline auto stride(std::size_t step)
+{
+  return makeAdaptor([step](const auto &source) { return stride(source, step); });
+}
+
+inline auto enumerate()
+{
+  return makeAdaptor([](const auto &source) { return enumerate(source); });
+}
+
+template <typename Source, typename Factory>
+auto operator|(const Source &source, const Adaptor<Factory> &adaptor) -> decltype(adaptor(source))
+{
+  return adaptor(source);
+}
+
+} // namespace views
+
+template <typename View, typename Type>
+void collectInto(const View &view, Vector<Type> &out);
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VIEWS_H
@@ -0,0 +1,98 @@
+#ifndef AISDI_LINEAR_DICT_VECTOR_CPP
+#define AISDI_LINEAR_DICT_VECTOR_CPP
+
+#include "../include/DictVector.hpp"
+#include "Vector.cpp"
+#include <limits>
+#include <stdexcept>
+
+namespace aisdi
+{
+
+template <typename T, typename C>
+DictVector<T, C>::DictVector(std::initializer_list<T> il)
+{
+    for (auto &elem : il)
+        append(elem);
+}
+
+template <typename T, typename C>
+const T &DictVector<T, C>::operator[](const size_type index) const
+{
+    return _dictionary.data()[_codes[index]];
+}
+
+template <typename T, typename C>
+void DictVector<T, C>::append(const T &item)
+{
+    auto found = _lookup.find(item);
+    if (found != _lookup.end())
+    {
+        _codes.append(found->second);
+        return;
+    }
+
+    if (_dictionary.getSize() > std::numeric_limits<C>::max())
+        throw std::length_error("Too many distinct values for code type");
+
+    C code = static_cast<C>(_dictionary.getSize());
+    _dictionary.append(item);
+    _lookup.emplace(item, code);
+    _codes.append(code);
+}
+
+template <typename T, typename C>
+bool DictVector<T, C>::findCode(const T &value, C &code) const
+{
+    auto found = _lookup.find(value);
+    if (found == _lookup.end())
+        return false;
+
+    code = found->second;
+    return true;
+}
+
+template <typename T, typename C>
+typename DictVector<T, C>::size_type DictVector<T, C>::countEqual(const T &value) const
+{
+    C code;
+    if (!findCode(value, code))
+        return 0;
+
+    const C *codes = _codes.data();
+    size_type size = _codes.getSize();
+    size_type count = 0;
+    for (size_type i = 0; i < size; ++i)
+        count += codes[i] == code;
+    return count;
+}
+
+template <typename T, typename C>
+void DictVector<T, C>::findEqual(const T &value, Vector<size_type> &out) const
+{
+    C code;
+    if (!findCode(value, code))
+        return;
+
+    const C *codes = _codes.data();
+    size_type size = _codes.getSize();
+    for (size_type i = 0; i < size; ++i)
+        if (codes[i] == code)
+            out.append(i);
+}
+
+template <typename T, typename C>
+void DictVector<T, C>::materialize(Vector<T> &out) const
+{
+    const T *dictionary = _dictionary.data();
+    const C *codes = _codes.data();
+    size_type size = _codes.getSize();
+
+    out.reserve(out.getSize() + size);
+    for (size_type i = 0; i < size; ++i)
+        out.append(dictionary[codes[i]]);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_DICT_VECTOR_CPP
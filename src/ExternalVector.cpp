@@ -0,0 +1,351 @@
+#ifndef AISDI_LINEAR_EXTERNAL_VECTOR_CPP
+#define AISDI_LINEAR_EXTERNAL_VECTOR_CPP
+
+#include "../include/ExternalVector.hpp"
+#include "Heap.cpp"
+#include "Vector.cpp"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// merge inputs get at least this many bytes of buffer each
+const std::size_t MinMergeBufferBytes = 64 << 10;
+
+/**
+ * @brief creates a file in directory that is removed as soon as it is
+ *        closed; the name is unlinked right away.
+ */
+inline int createSpillFile(const std::string &directory)
+{
+    std::string path = directory;
+    if (path.empty())
+    {
+        const char *tmp = std::getenv("TMPDIR");
+        path = tmp != nullptr && *tmp != '\0' ? tmp : "/tmp";
+    }
+    path += "/aisdi-spill-XXXXXX";
+
+    int fd = mkstemp(&path[0]);
+    if (fd < 0)
+        throw std::system_error(errno, std::generic_category(), "Creating spill file failed");
+    unlink(path.c_str());
+    return fd;
+}
+
+inline void readFully(int fd, std::size_t offset, void *buffer, std::size_t bytes)
+{
+    char *out = static_cast<char *>(buffer);
+    while (bytes > 0)
+    {
+        ssize_t result = pread(fd, out, bytes, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result < 0)
+            throw std::system_error(errno, std::generic_category(), "Reading spill file failed");
+        if (result == 0)
+            throw std::system_error(EIO, std::generic_category(), "Spill file ends early");
+        out += result;
+        offset += result;
+        bytes -= result;
+    }
+}
+
+inline void writeFully(int fd, std::size_t offset, const void *buffer, std::size_t bytes)
+{
+    const char *in = static_cast<const char *>(buffer);
+    while (bytes > 0)
+    {
+        ssize_t result = pwrite(fd, in, bytes, static_cast<off_t>(offset));
+        if (result < 0 && errno == EINTR)
+            continue;
+        if (result < 0)
+            throw std::system_error(errno, std::generic_category(), "Writing spill file failed");
+        in += result;
+        offset += result;
+        bytes -= result;
+    }
+}
+
+template <typename T>
+struct MergeEntry
+{
+    T value;
+    std::size_t input;
+};
+
+template <typename T, typename Compare>
+struct MergeEntryBefore
+{
+    Compare *compare;
+
+    bool operator()(const MergeEntry<T> &a, const MergeEntry<T> &b) const { return (*compare)(a.value, b.value); }
+};
+
+} // namespace detail
+
+template <typename T>
+ExternalVector<T>::ExternalVector(size_type memoryBudget, const std::string &directory)
+    : _directory(directory), _fd(-1), _budget(memoryBudget),
+      _blockSize(memoryBudget / 4 / sizeof(T) > 0 ? memoryBudget / 4 / sizeof(T) : 1), _spilled(0)
+{
+    // last, so no member can throw after the file is open
+    _fd = detail::createSpillFile(directory);
+}
+
+template <typename T>
+ExternalVector<T>::~ExternalVector()
+{
+    if (_pendingWrite.valid())
+        _pendingWrite.wait();
+    close(_fd);
+}
+
+template <typename T>
+void ExternalVector<T>::append(const T &item)
+{
+    if (_tail.getSize() == _blockSize)
+        spillTail();
+    // grows by doubling but never past one block, small vectors stay small
+    if (_tail.getSize() == _tail.getCapacity())
+        _tail.reserve(std::min(2 * _tail.getCapacity() + 1, _blockSize));
+    _tail.append(item);
+}
+
+template <typename T>
+T ExternalVector<T>::get(size_type index) const
+{
+    if (index >= getSize())
+        throw std::out_of_range("Index out of range");
+
+    size_type firstInTail = _spilled * _blockSize;
+    if (index >= firstInTail)
+        return _tail[index - firstInTail];
+
+    T item;
+    readElements(index, 1, &item);
+    return item;
+}
+
+template <typename T>
+void ExternalVector<T>::flush() const
+{
+    if (_pendingWrite.valid())
+        _pendingWrite.get();
+}
+
+/**
+ * @brief while the callback works on one block the next one is read by a
+ *        background task into a second buffer.
+ */
+template <typename T>
+template <typename Visit>
+void ExternalVector<T>::scan(Visit visit) const
+{
+    if (_spilled > 0)
+    {
+        Vector<T> current, ahead;
+        current.resizeDefaultInit(_blockSize);
+        ahead.resizeDefaultInit(_blockSize);
+        readElements(0, _blockSize, current.data());
+
+        for (size_type block = 0; block < _spilled; ++block)
+        {
+            std::future<void> next;
+            if (block + 1 < _spilled)
+                next = std::async(std::launch::async, [this, &ahead, block] {
+                    readElements((block + 1) * _blockSize, _blockSize, ahead.data());
+                });
+
+            visit(static_cast<const T *>(current.data()), _blockSize);
+            if (next.valid())
+            {
+                next.get();
+                std::swap(current, ahead);
+            }
+        }
+    }
+
+    if (!_tail.isEmpty())
+        visit(_tail.data(), _tail.getSize());
+}
+
+template <typename T>
+template <typename Visit>
+void ExternalVector<T>::forEach(Visit visit) const
+{
+    scan([&visit](const T *items, size_type count) {
+        for (size_type i = 0; i < count; ++i)
+            visit(items[i]);
+    });
+}
+
+template <typename T>
+template <typename Compare>
+void ExternalVector<T>::sort(Compare compare)
+{
+    flush();
+    if (_spilled == 0)
+    {
+        std::sort(_tail.data(), _tail.data() + _tail.getSize(), compare);
+        return;
+    }
+
+    // sorted runs of one block each, the tail becomes the last, shorter one
+    size_type size = getSize();
+    Vector<size_type> runs;
+    {
+        Vector<T> block;
+        block.resizeDefaultInit(_blockSize);
+        for (size_type i = 0; i < _spilled; ++i)
+        {
+            readElements(i * _blockSize, _blockSize, block.data());
+            std::sort(block.data(), block.data() + _blockSize, compare);
+            detail::writeFully(_fd, i * _blockSize * sizeof(T), block.data(), _blockSize * sizeof(T));
+            runs.append(i * _blockSize);
+        }
+    }
+    if (!_tail.isEmpty())
+    {
+        std::sort(_tail.data(), _tail.data() + _tail.getSize(), compare);
+        detail::writeFully(_fd, _spilled * _blockSize * sizeof(T), _tail.data(), _tail.getSize() * sizeof(T));
+        runs.append(_spilled * _blockSize);
+    }
+    runs.append(size);
+
+    size_type fanIn = _blockSize * sizeof(T) / detail::MinMergeBufferBytes;
+    fanIn = fanIn < 2 ? 2 : fanIn;
+
+    int other = -1;
+    try
+    {
+        while (runs.getSize() > 2)
+        {
+            if (other < 0)
+                other = detail::createSpillFile(_directory);
+            mergePass(_fd, other, runs, fanIn, compare);
+            std::swap(_fd, other);
+        }
+    }
+    catch (...)
+    {
+        if (other >= 0)
+            close(other);
+        throw;
+    }
+    if (other >= 0)
+        close(other);
+
+    _spilled = size / _blockSize;
+    _tail.resizeDefaultInit(size % _blockSize);
+    readElements(_spilled * _blockSize, _tail.getSize(), _tail.data());
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief hands the full tail to a background write and continues in the
+ *        other buffer, waiting first for the previous write to finish.
+ */
+template <typename T>
+void ExternalVector<T>::spillTail()
+{
+    flush();
+    std::swap(_tail, _writing);
+    _tail.resizeDefaultInit(0);
+    _tail.reserve(_blockSize); // a vector that spills needs both blocks
+
+    size_type offset = _spilled * _blockSize * sizeof(T);
+    _pendingWrite = std::async(std::launch::async, [this, offset] {
+        detail::writeFully(_fd, offset, _writing.data(), _blockSize * sizeof(T));
+    });
+    ++_spilled;
+}
+
+template <typename T>
+void ExternalVector<T>::readElements(size_type first, size_type count, T *out) const
+{
+    flush();
+    detail::readFully(_fd, first * sizeof(T), out, count * sizeof(T));
+}
+
+/**
+ * @brief merges every fanIn consecutive runs of file 'from' into one run
+ *        at the same place in file 'to'. Each input reads through its own
+ *        share of one block, the output is written a block at a time.
+ */
+template <typename T>
+template <typename Compare>
+void ExternalVector<T>::mergePass(int from, int to, Vector<size_type> &runs, size_type fanIn, Compare &compare)
+{
+    size_type bufferSize = _blockSize / fanIn > 0 ? _blockSize / fanIn : 1;
+    Vector<T> inputs, output;
+    inputs.resizeDefaultInit(fanIn * bufferSize);
+    output.resizeDefaultInit(_blockSize);
+    Vector<size_type> next(fanIn), end(fanIn), position(fanIn), filled(fanIn);
+    Vector<size_type> merged;
+    merged.append(0);
+
+    auto refill = [&](size_type input) {
+        filled[input] = end[input] - next[input] < bufferSize ? end[input] - next[input] : bufferSize;
+        detail::readFully(from, next[input] * sizeof(T), inputs.data() + input * bufferSize, filled[input] * sizeof(T));
+        next[input] += filled[input];
+        position[input] = 0;
+    };
+
+    for (size_type group = 0; group + 1 < runs.getSize(); group += fanIn)
+    {
+        size_type last = group + fanIn < runs.getSize() - 1 ? group + fanIn : runs.getSize() - 1;
+        using Entry = detail::MergeEntry<T>;
+        Heap<Entry, detail::MergeEntryBefore<T, Compare>> heap(detail::MergeEntryBefore<T, Compare>{&compare});
+
+        for (size_type input = 0; input < last - group; ++input)
+        {
+            next[input] = runs[group + input];
+            end[input] = runs[group + input + 1];
+            refill(input);
+            heap.push(Entry{inputs[input * bufferSize], input});
+        }
+
+        size_type written = runs[group], buffered = 0;
+        while (!heap.isEmpty())
+        {
+            Entry entry = heap.pop();
+            output[buffered++] = entry.value;
+            if (buffered == _blockSize)
+            {
+                detail::writeFully(to, written * sizeof(T), output.data(), buffered * sizeof(T));
+                written += buffered;
+                buffered = 0;
+            }
+
+            size_type input = entry.input;
+            if (++position[input] == filled[input])
+            {
+                if (next[input] == end[input])
+                    continue;
+                refill(input);
+            }
+            heap.push(Entry{inputs[input * bufferSize + position[input]], input});
+        }
+        detail::writeFully(to, written * sizeof(T), output.data(), buffered * sizeof(T));
+        merged.append(runs[last]);
+    }
+    runs = std::move(merged);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_EXTERNAL_VECTOR_CPP
@@ -0,0 +1,227 @@
+#ifndef AISDI_LINEAR_GAP_VECTOR_CPP
+#define AISDI_LINEAR_GAP_VECTOR_CPP
+
+#include "../include/GapVector.hpp"
+#include <cassert>
+#include <utility>
+
+namespace aisdi
+{
+
+template <typename T>
+GapVector<T>::GapVector()
+    : _array(new T[_defaultCapacity]), _capacity(_defaultCapacity), _gapBegin(0), _gapEnd(_defaultCapacity) {}
+
+template <typename T>
+GapVector<T>::GapVector(std::initializer_list<T> il) : GapVector()
+{
+    for (auto &elem : il)
+        append(elem);
+}
+
+template <typename T>
+GapVector<T>::GapVector(const GapVector<T> &other)
+    : _array(new T[other._capacity]), _capacity(other._capacity), _gapBegin(other._gapBegin), _gapEnd(other._gapEnd)
+{
+    for (size_type i = 0; i < _gapBegin; i++)
+        _array[i] = other._array[i];
+    for (size_type i = _gapEnd; i < _capacity; i++)
+        _array[i] = other._array[i];
+}
+
+template <typename T>
+GapVector<T>::GapVector(GapVector<T> &&other)
+    : _array(other._array), _capacity(other._capacity), _gapBegin(other._gapBegin), _gapEnd(other._gapEnd)
+{
+    other._array = nullptr;
+    other._capacity = other._gapBegin = other._gapEnd = 0;
+}
+
+template <typename T>
+GapVector<T> &GapVector<T>::operator=(const GapVector<T> &other)
+{
+    if (this != &other)
+    {
+        GapVector<T> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+GapVector<T> &GapVector<T>::operator=(GapVector<T> &&other)
+{
+    if (this == &other)
+        return *this;
+
+    delete[] _array;
+    _array = other._array;
+    _capacity = other._capacity;
+    _gapBegin = other._gapBegin;
+    _gapEnd = other._gapEnd;
+
+    other._array = nullptr;
+    other._capacity = other._gapBegin = other._gapEnd = 0;
+    return *this;
+}
+
+template <typename T>
+T &GapVector<T>::operator[](const size_type index)
+{
+    if (index >= getSize())
+        throw std::out_of_range("Index out of range");
+
+    return _array[physicalIndex(index)];
+}
+
+template <typename T>
+const T &GapVector<T>::operator[](const size_type index) const
+{
+    if (index >= getSize())
+        throw std::out_of_range("Index out of range");
+
+    return _array[physicalIndex(index)];
+}
+
+/**
+ * @brief moves the gap so that it starts at position. Only the elements
+ *        between the old and the new cursor are moved.
+ *
+ * @param position new cursor, at most size
+ */
+template <typename T>
+void GapVector<T>::moveCursor(size_type position)
+{
+    if (position > getSize())
+        throw std::out_of_range("Cursor out of range");
+
+    while (_gapBegin > position)
+        _array[--_gapEnd] = std::move(_array[--_gapBegin]);
+
+    while (_gapBegin < position)
+        _array[_gapBegin++] = std::move(_array[_gapEnd++]);
+}
+
+template <typename T>
+void GapVector<T>::insertAtCursor(const T &item)
+{
+    if (_gapBegin == _gapEnd)
+    {
+        T copy = item; // item may be one of our elements
+        grow();
+        _array[_gapBegin++] = std::move(copy);
+        return;
+    }
+    _array[_gapBegin++] = item;
+}
+
+template <typename T>
+void GapVector<T>::eraseBeforeCursor()
+{
+    if (_gapBegin == 0)
+        throw std::out_of_range("Nothing before cursor");
+
+    --_gapBegin;
+}
+
+template <typename T>
+void GapVector<T>::eraseAfterCursor()
+{
+    if (_gapEnd == _capacity)
+        throw std::out_of_range("Nothing after cursor");
+
+    ++_gapEnd;
+}
+
+template <typename T>
+void GapVector<T>::append(const T &item)
+{
+    moveCursor(getSize());
+    insertAtCursor(item);
+}
+
+template <typename T>
+void GapVector<T>::prepend(const T &item)
+{
+    moveCursor(0);
+    insertAtCursor(item);
+}
+
+template <typename T>
+void GapVector<T>::insert(const const_iterator &insertPosition, const T &item)
+{
+    moveCursor(insertPosition.getPosition());
+    insertAtCursor(item);
+}
+
+template <typename T>
+T GapVector<T>::popFirst()
+{
+    if (isEmpty())
+        throw std::length_error("Popped empty vector");
+
+    moveCursor(0);
+    return std::move(_array[_gapEnd++]);
+}
+
+template <typename T>
+T GapVector<T>::popLast()
+{
+    if (isEmpty())
+        throw std::length_error("Popped empty vector");
+
+    moveCursor(getSize());
+    return std::move(_array[--_gapBegin]);
+}
+
+template <typename T>
+void GapVector<T>::erase(const const_iterator &possition)
+{
+    if (possition.getPosition() >= getSize())
+        throw std::out_of_range("Erasing outside of vector");
+
+    moveCursor(possition.getPosition());
+    eraseAfterCursor();
+}
+
+template <typename T>
+void GapVector<T>::erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded)
+{
+    size_type first = firstIncluded.getPosition();
+    size_type last = lastExcluded.getPosition();
+    if (first > last || last > getSize())
+        throw std::out_of_range("Erasing outside of vector");
+
+    moveCursor(first);
+    _gapEnd += last - first;
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief doubles capacity. Elements before the cursor stay at the front,
+ *        elements after it go to the back, the new slots become the gap.
+ */
+template <typename T>
+void GapVector<T>::grow()
+{
+    size_type newCapacity = _capacity > 0 ? 2 * _capacity : _defaultCapacity;
+    size_type tail = _capacity - _gapEnd;
+    T *newArray = new T[newCapacity];
+
+    for (size_type i = 0; i < _gapBegin; i++)
+        newArray[i] = std::move(_array[i]);
+    for (size_type i = 0; i < tail; i++)
+        newArray[newCapacity - tail + i] = std::move(_array[_gapEnd + i]);
+
+    delete[] _array;
+    _array = newArray;
+    _gapEnd = newCapacity - tail;
+    _capacity = newCapacity;
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_GAP_VECTOR_CPP
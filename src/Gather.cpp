@@ -0,0 +1,203 @@
+#ifndef AISDI_LINEAR_GATHER_CPP
+#define AISDI_LINEAR_GATHER_CPP
+
+#include "../include/Gather.hpp"
+#include "Vector.cpp"
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// one pass taking the maximum, which vectorises, instead of a branch per index
+template <typename Index>
+void checkIndices(const Index *indices, std::size_t count, std::size_t limit)
+{
+    std::size_t largest = 0;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        std::size_t index = static_cast<std::size_t>(indices[i]);
+        largest = index > largest ? index : largest;
+    }
+    if (count > 0 && largest >= limit)
+        throw std::out_of_range("Index out of range");
+}
+
+template <typename T, typename Index>
+void gatherScalar(const T *source, const Index *indices, T *destination, std::size_t begin, std::size_t count,
+                  std::size_t prefetchDistance)
+{
+    std::size_t i = begin;
+    if (prefetchDistance > 0)
+        for (; i + prefetchDistance < count; ++i)
+        {
+            __builtin_prefetch(source + indices[i + prefetchDistance]);
+            destination[i] = source[indices[i]];
+        }
+    for (; i < count; ++i)
+        destination[i] = source[indices[i]];
+}
+
+#ifdef __AVX2__
+/**
+ * @brief hardware gather of 4 or 8 byte elements, moved as integers of the
+ *        same width. 32 bit indices are sign extended by the instruction,
+ *        so they are only used when every index fits in an int.
+ *        Returns the number of elements copied.
+ */
+template <typename T, typename Index>
+std::size_t gatherVector(const T *source, std::size_t sourceSize, const Index *indices, T *destination,
+                         std::size_t count, std::size_t prefetchDistance)
+{
+    const bool narrowIndices = sizeof(Index) == 4 && sourceSize <= static_cast<std::size_t>(INT32_MAX);
+    std::size_t i = 0;
+
+    if constexpr (sizeof(T) == 8 && sizeof(Index) == 8)
+    {
+        const long long *base = reinterpret_cast<const long long *>(source);
+        for (; i + 4 <= count; i += 4)
+        {
+            if (prefetchDistance > 0 && i + prefetchDistance < count)
+                __builtin_prefetch(source + indices[i + prefetchDistance]);
+            __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            __m256i values = _mm256_i64gather_epi64(base, offsets, 8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), values);
+        }
+    }
+    else if constexpr (sizeof(T) == 8 && sizeof(Index) == 4)
+    {
+        const long long *base = reinterpret_cast<const long long *>(source);
+        for (; narrowIndices && i + 4 <= count; i += 4)
+        {
+            if (prefetchDistance > 0 && i + prefetchDistance < count)
+                __builtin_prefetch(source + indices[i + prefetchDistance]);
+            __m128i offsets = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+            __m256i values = _mm256_i32gather_epi64(base, offsets, 8);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), values);
+        }
+    }
+    else if constexpr (sizeof(T) == 4 && sizeof(Index) == 4)
+    {
+        const int *base = reinterpret_cast<const int *>(source);
+        for (; narrowIndices && i + 8 <= count; i += 8)
+        {
+            if (prefetchDistance > 0 && i + prefetchDistance < count)
+                __builtin_prefetch(source + indices[i + prefetchDistance]);
+            __m256i offsets = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(indices + i));
+            __m256i values = _mm256_i32gather_epi32(base, offsets, 4);
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), values);
+        }
+    }
+    return i;
+}
+#else
+template <typename T, typename Index>
+std::size_t gatherVector(const T *, std::size_t, const Index *, T *, std::size_t, std::size_t)
+{
+    return 0;
+}
+#endif
+
+inline bool testAndSet(std::uint64_t *bits, std::size_t position)
+{
+    std::uint64_t mask = std::uint64_t(1) << (position % 64);
+    bool wasSet = (bits[position / 64] & mask) != 0;
+    bits[position / 64] |= mask;
+    return wasSet;
+}
+
+} // namespace detail
+
+template <typename T, typename Index>
+void gather(const Vector<T> &source, const Vector<Index> &indices, Vector<T> &destination, std::size_t prefetchDistance)
+{
+    if (&destination == &source)
+        throw std::invalid_argument("Gathering into the source vector");
+
+    std::size_t count = indices.getSize();
+    detail::checkIndices(indices.data(), count, source.getSize());
+    destination.resizeDefaultInit(count);
+
+    std::size_t done = 0;
+    if constexpr (std::is_trivially_copyable<T>::value && std::is_integral<Index>::value)
+        done = detail::gatherVector(source.data(), source.getSize(), indices.data(), destination.data(), count,
+                                    prefetchDistance);
+    detail::gatherScalar(source.data(), indices.data(), destination.data(), done, count, prefetchDistance);
+}
+
+template <typename T, typename Index>
+void scatter(const Vector<T> &source, const Vector<Index> &indices, Vector<T> &destination, std::size_t prefetchDistance)
+{
+    if (indices.getSize() != source.getSize())
+        throw std::invalid_argument("Scattering with indices of different size");
+    if (&destination == &source)
+        throw std::invalid_argument("Scattering into the source vector");
+
+    std::size_t count = indices.getSize();
+    detail::checkIndices(indices.data(), count, destination.getSize());
+
+    const T *from = source.data();
+    const Index *to = indices.data();
+    T *out = destination.data();
+    std::size_t i = 0;
+    if (prefetchDistance > 0)
+        for (; i + prefetchDistance < count; ++i)
+        {
+            __builtin_prefetch(out + to[i + prefetchDistance], 1);
+            out[to[i]] = from[i];
+        }
+    for (; i < count; ++i)
+        out[to[i]] = from[i];
+}
+
+template <typename T, typename Index>
+void applyPermutation(Vector<T> &values, const Vector<Index> &permutation)
+{
+    std::size_t size = values.getSize();
+    if (permutation.getSize() != size)
+        throw std::invalid_argument("Permutation of different size");
+
+    const Index *next = permutation.data();
+    Vector<std::uint64_t> seen((size + 63) / 64);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        std::size_t target = static_cast<std::size_t>(next[i]);
+        if (target >= size || detail::testAndSet(seen.data(), target))
+            throw std::invalid_argument("Not a permutation");
+    }
+
+    // second pass clears the bits again as positions get their final value
+    T *data = values.data();
+    std::uint64_t *pending = seen.data();
+    for (std::size_t start = 0; start < size; ++start)
+    {
+        if ((pending[start / 64] >> (start % 64) & 1) == 0)
+            continue;
+
+        T first = std::move(data[start]);
+        std::size_t current = start;
+        while (true)
+        {
+            pending[current / 64] &= ~(std::uint64_t(1) << (current % 64));
+            std::size_t source = static_cast<std::size_t>(next[current]);
+            if (source == start)
+                break;
+            data[current] = std::move(data[source]);
+            current = source;
+        }
+        data[current] = std::move(first);
+    }
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_GATHER_CPP
@@ -0,0 +1,244 @@
+#ifndef AISDI_LINEAR_HEAP_CPP
+#define AISDI_LINEAR_HEAP_CPP
+
+#include "../include/Heap.hpp"
+#include "Vector.cpp"
+#include <utility>
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+/**
+ * @brief moves the element at position towards the root while it compares
+ *        before its parent. Parents slide down into the hole instead of
+ *        being swapped; moved(element, position) reports every final place.
+ */
+template <std::size_t Arity, typename T, typename Before, typename Moved>
+void heapSiftUp(T *items, std::size_t position, Before &before, Moved moved)
+{
+    T item = std::move(items[position]);
+    while (position > 0)
+    {
+        std::size_t parent = (position - 1) / Arity;
+        if (!before(item, items[parent]))
+            break;
+        items[position] = std::move(items[parent]);
+        moved(items[position], position);
+        position = parent;
+    }
+    items[position] = std::move(item);
+    moved(items[position], position);
+}
+
+// the opposite direction: the best child moves up while it beats the item
+template <std::size_t Arity, typename T, typename Before, typename Moved>
+void heapSiftDown(T *items, std::size_t size, std::size_t position, Before &before, Moved moved)
+{
+    T item = std::move(items[position]);
+    while (true)
+    {
+        std::size_t first = position * Arity + 1;
+        if (first >= size)
+            break;
+        std::size_t last = size - first > Arity ? first + Arity : size;
+        std::size_t best = first;
+        for (std::size_t child = first + 1; child < last; ++child)
+            if (before(items[child], items[best]))
+                best = child;
+        if (!before(items[best], item))
+            break;
+        items[position] = std::move(items[best]);
+        moved(items[position], position);
+        position = best;
+    }
+    items[position] = std::move(item);
+    moved(items[position], position);
+}
+
+template <typename T>
+void ignoreMove(const T &, std::size_t) {}
+
+} // namespace detail
+
+template <typename T, typename C, std::size_t A, typename I>
+const T &Heap<T, C, A, I>::top() const
+{
+    if (_items.isEmpty())
+        throw std::length_error("Top of empty heap");
+
+    return _items[0];
+}
+
+template <typename T, typename C, std::size_t A, typename I>
+T Heap<T, C, A, I>::pop()
+{
+    if (_items.isEmpty())
+        throw std::length_error("Popped empty heap");
+
+    T result = std::move(_items[0]);
+    if constexpr (_tracksPositions)
+        _positions[_idOf(result)] = _absent;
+
+    T last = _items.popLast();
+    if (!_items.isEmpty())
+    {
+        _items[0] = std::move(last);
+        siftDown(0);
+    }
+    return result;
+}
+
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::push(const T &item)
+{
+    _items.append(item);
+    place(_items.getSize() - 1);
+    siftUp(_items.getSize() - 1);
+}
+
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::pushRange(const T *items, size_type count)
+{
+    if (count <= _items.getSize())
+    {
+        for (size_type i = 0; i < count; ++i)
+            push(items[i]);
+        return;
+    }
+
+    _items.reserve(_items.getSize() + count);
+    try
+    {
+        for (size_type i = 0; i < count; ++i)
+        {
+            _items.append(items[i]);
+            place(_items.getSize() - 1);
+        }
+    }
+    catch (...)
+    {
+        heapify(); // keep what was added before the duplicate id
+        throw;
+    }
+    heapify();
+}
+
+template <typename T, typename C, std::size_t A, typename I>
+bool Heap<T, C, A, I>::contains(size_type id) const
+{
+    static_assert(_tracksPositions, "Heap::contains needs an IdOf functor");
+    return id < _positions.getSize() && _positions[id] != _absent;
+}
+
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::decreaseKey(size_type id, const T &value)
+{
+    static_assert(_tracksPositions, "Heap::decreaseKey needs an IdOf functor");
+    if (!contains(id) || static_cast<size_type>(_idOf(value)) != id)
+        throw std::invalid_argument("Decreasing key of an id not in heap");
+
+    size_type position = _positions[id];
+    if (_compare(_items[position], value))
+        throw std::invalid_argument("Decreasing key to a later value");
+
+    _items[position] = value;
+    siftUp(position);
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::siftUp(size_type position)
+{
+    detail::heapSiftUp<A>(_items.data(), position, _compare,
+                          [this](const T &item, size_type to) { track(item, to); });
+}
+
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::siftDown(size_type position)
+{
+    detail::heapSiftDown<A>(_items.data(), _items.getSize(), position, _compare,
+                            [this](const T &item, size_type to) { track(item, to); });
+}
+
+// Floyd's bottom up construction, O(n)
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::heapify()
+{
+    if (_items.isEmpty())
+        return;
+
+    for (size_type position = (_items.getSize() - 1) / A + 1; position-- > 0;)
+        siftDown(position);
+}
+
+/**
+ * @brief records the position of a newly appended element. A second
+ *        element with the id of one already in the heap is removed again
+ *        and std::invalid_argument thrown.
+ */
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::place(size_type position)
+{
+    if constexpr (_tracksPositions)
+    {
+        size_type id = static_cast<size_type>(_idOf(_items[position]));
+        if (id >= _positions.getSize())
+            _positions.resize(id + 1, _absent);
+        if (_positions[id] != _absent)
+        {
+            _items.popLast();
+            throw std::invalid_argument("Id already in heap");
+        }
+        _positions[id] = position;
+    }
+}
+
+template <typename T, typename C, std::size_t A, typename I>
+void Heap<T, C, A, I>::track(const T &item, size_type position)
+{
+    if constexpr (_tracksPositions)
+        _positions[static_cast<size_type>(_idOf(item))] = position;
+}
+
+template <typename T, typename Compare>
+void topK(Vector<T> &items, std::size_t k, Compare compare)
+{
+    const std::size_t arity = 4;
+    if (k > items.getSize())
+        k = items.getSize();
+    if (k == 0)
+    {
+        items.resize(0);
+        return;
+    }
+
+    T *data = items.data();
+    auto worstFirst = [&compare](const T &a, const T &b) { return compare(b, a); };
+    for (std::size_t position = (k - 1) / arity + 1; position-- > 0;)
+        detail::heapSiftDown<arity>(data, k, position, worstFirst, detail::ignoreMove<T>);
+
+    for (std::size_t i = k; i < items.getSize(); ++i)
+        if (compare(data[i], data[0]))
+        {
+            data[0] = std::move(data[i]);
+            detail::heapSiftDown<arity>(data, k, 0, worstFirst, detail::ignoreMove<T>);
+        }
+
+    // heap sort: the worst of the remaining ones goes to the back
+    for (std::size_t end = k; end-- > 1;)
+    {
+        std::swap(data[0], data[end]);
+        detail::heapSiftDown<arity>(data, end, 0, worstFirst, detail::ignoreMove<T>);
+    }
+    items.resize(k);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_HEAP_CPP
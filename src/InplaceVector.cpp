@@ -0,0 +1,184 @@
+#ifndef AISDI_LINEAR_INPLACE_VECTOR_CPP
+#define AISDI_LINEAR_INPLACE_VECTOR_CPP
+
+#include "../include/InplaceVector.hpp"
+
+namespace aisdi
+{
+
+template <typename T, std::size_t N>
+constexpr InplaceVector<T, N>::InplaceVector(std::initializer_list<T> il)
+{
+    if (il.size() > N)
+        throw std::length_error("Initializer list exceeds capacity");
+
+    for (auto &elem : il)
+        append(elem);
+}
+
+template <typename T, std::size_t N>
+constexpr T &InplaceVector<T, N>::operator[](const size_type index)
+{
+    if (index >= this->_size)
+        throw std::out_of_range("Index out of range");
+
+    return *this->slot(index);
+}
+
+template <typename T, std::size_t N>
+constexpr const T &InplaceVector<T, N>::operator[](const size_type index) const
+{
+    if (index >= this->_size)
+        throw std::out_of_range("Index out of range");
+
+    return *this->slot(index);
+}
+
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::append(const T &item)
+{
+    if (!tryAppend(item))
+        throw std::length_error("Appending to full vector");
+}
+
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::append(T &&item)
+{
+    if (!tryAppend(std::move(item)))
+        throw std::length_error("Appending to full vector");
+}
+
+template <typename T, std::size_t N>
+constexpr bool InplaceVector<T, N>::tryAppend(const T &item) noexcept(std::is_nothrow_copy_constructible<T>::value)
+{
+    if (this->_size == N)
+        return false;
+
+    this->construct(this->_size, item);
+    ++this->_size;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr bool InplaceVector<T, N>::tryAppend(T &&item) noexcept(std::is_nothrow_move_constructible<T>::value)
+{
+    if (this->_size == N)
+        return false;
+
+    this->construct(this->_size, std::move(item));
+    ++this->_size;
+    return true;
+}
+
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::prepend(const T &item)
+{
+    insert(cbegin(), item);
+}
+
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::insert(const_iterator insertPosition, const T &item)
+{
+    if (this->_size == N)
+        throw std::length_error("Inserting into full vector");
+    if (insertPosition < cbegin() || insertPosition > cend())
+        throw std::out_of_range("Inserting outside of vector");
+
+    size_type position = insertPosition - cbegin();
+    if (position == this->_size)
+    {
+        this->construct(position, item);
+    }
+    else
+    {
+        T copy = item; // item may live inside the shifted range
+        shiftRight(position);
+        *this->slot(position) = std::move(copy);
+    }
+    ++this->_size;
+}
+
+template <typename T, std::size_t N>
+constexpr T InplaceVector<T, N>::popFirst()
+{
+    if (this->_size == 0)
+        throw std::length_error("Popped empty vector");
+
+    T temp = std::move(*this->slot(0));
+    shiftLeft(1, 1);
+    return temp;
+}
+
+template <typename T, std::size_t N>
+constexpr T InplaceVector<T, N>::popLast()
+{
+    if (this->_size == 0)
+        throw std::length_error("Popped empty vector");
+
+    T temp = std::move(*this->slot(this->_size - 1));
+    this->destroy(--this->_size);
+    return temp;
+}
+
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::erase(const_iterator possition)
+{
+    if (possition < cbegin() || possition >= cend())
+        throw std::out_of_range("Erasing outside of vector");
+
+    shiftLeft(possition - cbegin() + 1, 1);
+}
+
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::erase(const_iterator firstIncluded, const_iterator lastExcluded)
+{
+    if (firstIncluded < cbegin() || lastExcluded > cend() || firstIncluded > lastExcluded)
+        throw std::out_of_range("Erasing outside of vector");
+
+    if (firstIncluded == lastExcluded)
+        return;
+
+    shiftLeft(lastExcluded - cbegin(), lastExcluded - firstIncluded);
+}
+
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::clear()
+{
+    while (this->_size > 0)
+        this->destroy(--this->_size);
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief moves elements [from, size) one slot to the right. The slot past
+ *        the end is constructed, the others are assigned. Size is unchanged.
+ */
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::shiftRight(size_type from)
+{
+    size_type last = this->_size;
+    this->construct(last, std::move(*this->slot(last - 1)));
+    for (size_type i = last - 1; i > from; --i)
+        *this->slot(i) = std::move(*this->slot(i - 1));
+}
+
+/**
+ * @brief moves elements [from, size) 'jump' slots to the left, destroys the
+ *        vacated slots at the end and shrinks size by 'jump'.
+ */
+template <typename T, std::size_t N>
+constexpr void InplaceVector<T, N>::shiftLeft(size_type from, size_type jump)
+{
+    for (size_type i = from; i < this->_size; ++i)
+        *this->slot(i - jump) = std::move(*this->slot(i));
+
+    for (size_type i = 0; i < jump; ++i)
+        this->destroy(--this->_size);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_INPLACE_VECTOR_CPP
@@ -0,0 +1,230 @@
+#ifndef AISDI_LINEAR_MATRIX_VIEW_CPP
+#define AISDI_LINEAR_MATRIX_VIEW_CPP
+
+#include "../include/MatrixView.hpp"
+#include "Vector.cpp"
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+const std::size_t TransposeTile = 32;   // 32x32 doubles, two tiles fit in L1
+const std::size_t MultiplyColumns = 2048; // block of the input vector kept in L1
+const std::size_t MultiplyRows = 4;       // rows sharing one pass over the block
+
+template <typename T>
+void checkStorage(const Vector<T> &storage, std::size_t rows, std::size_t columns)
+{
+    if (rows * columns > storage.getSize())
+        throw std::out_of_range("Matrix exceeds storage");
+}
+
+/**
+ * @brief calls visit(row, column, element) for every element, walking the
+ *        smaller stride in the inner loop.
+ */
+template <typename T, typename Visit>
+void visitInMemoryOrder(const BasicMatrixView<T> &matrix, Visit visit)
+{
+    T *data = matrix.data();
+    std::size_t rowStride = matrix.getRowStride(), columnStride = matrix.getColumnStride();
+
+    if (rowStride < columnStride)
+    {
+        for (std::size_t c = 0; c < matrix.getColumns(); ++c)
+            for (std::size_t r = 0; r < matrix.getRows(); ++r)
+                visit(r, c, data[r * rowStride + c * columnStride]);
+    }
+    else
+    {
+        for (std::size_t r = 0; r < matrix.getRows(); ++r)
+            for (std::size_t c = 0; c < matrix.getColumns(); ++c)
+                visit(r, c, data[r * rowStride + c * columnStride]);
+    }
+}
+
+// result[r] += sum of rows [r, r + MultiplyRows) times x over [begin, end)
+template <typename T>
+void multiplyRowTile(const T *rows, std::size_t rowStride, const T *x, std::size_t begin, std::size_t end, T *result)
+{
+    const T *row0 = rows, *row1 = rows + rowStride, *row2 = rows + 2 * rowStride, *row3 = rows + 3 * rowStride;
+    T sum0 = T(), sum1 = T(), sum2 = T(), sum3 = T();
+    for (std::size_t c = begin; c < end; ++c)
+    {
+        sum0 += row0[c] * x[c];
+        sum1 += row1[c] * x[c];
+        sum2 += row2[c] * x[c];
+        sum3 += row3[c] * x[c];
+    }
+    result[0] += sum0;
+    result[1] += sum1;
+    result[2] += sum2;
+    result[3] += sum3;
+}
+
+template <typename T>
+void multiplyRowMajor(const T *matrix, std::size_t rows, std::size_t columns, std::size_t rowStride, const T *x, T *result)
+{
+    for (std::size_t begin = 0; begin < columns; begin += MultiplyColumns)
+    {
+        std::size_t end = begin + MultiplyColumns < columns ? begin + MultiplyColumns : columns;
+        std::size_t r = 0;
+        for (; r + MultiplyRows <= rows; r += MultiplyRows)
+            multiplyRowTile(matrix + r * rowStride, rowStride, x, begin, end, result + r);
+        for (; r < rows; ++r)
+        {
+            const T *row = matrix + r * rowStride;
+            T sum = T();
+            for (std::size_t c = begin; c < end; ++c)
+                sum += row[c] * x[c];
+            result[r] += sum;
+        }
+    }
+}
+
+// result += column * x[c] for every column, the inner loop runs down a column
+template <typename T>
+void multiplyColumnMajor(const T *matrix, std::size_t rows, std::size_t columns, std::size_t columnStride, const T *x, T *result)
+{
+    for (std::size_t c = 0; c < columns; ++c)
+    {
+        const T *column = matrix + c * columnStride;
+        T factor = x[c];
+        for (std::size_t r = 0; r < rows; ++r)
+            result[r] += column[r] * factor;
+    }
+}
+
+} // namespace detail
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView(Vector<value_type> &storage, size_type rows, size_type columns, Layout layout)
+    : _data(storage.data()), _rows(rows), _columns(columns),
+      _rowStride(layout == Layout::RowMajor ? columns : 1), _columnStride(layout == Layout::RowMajor ? 1 : rows)
+{
+    detail::checkStorage(storage, rows, columns);
+}
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView(const Vector<value_type> &storage, size_type rows, size_type columns, Layout layout)
+    : _data(storage.data()), _rows(rows), _columns(columns),
+      _rowStride(layout == Layout::RowMajor ? columns : 1), _columnStride(layout == Layout::RowMajor ? 1 : rows)
+{
+    detail::checkStorage(storage, rows, columns);
+}
+
+template <typename T>
+T &BasicMatrixView<T>::operator()(size_type row, size_type column) const
+{
+    if (row >= _rows || column >= _columns)
+        throw std::out_of_range("Index out of range");
+
+    return _data[row * _rowStride + column * _columnStride];
+}
+
+template <typename T>
+BasicMatrixView<T> BasicMatrixView<T>::block(size_type row, size_type column, size_type rows, size_type columns) const
+{
+    if (row + rows > _rows || column + columns > _columns)
+        throw std::out_of_range("Block out of range");
+
+    return BasicMatrixView(_data + row * _rowStride + column * _columnStride, rows, columns, _rowStride, _columnStride);
+}
+
+/**
+ * @brief copies tile by tile, so that both the rows read from source and
+ *        the columns written to destination stay in cache within a tile.
+ */
+template <typename Source, typename T>
+void transpose(const BasicMatrixView<Source> &source, const BasicMatrixView<T> &destination)
+{
+    if (source.getRows() != destination.getColumns() || source.getColumns() != destination.getRows())
+        throw std::invalid_argument("Transposing into a matrix of different shape");
+
+    const std::size_t tile = detail::TransposeTile;
+    const Source *in = source.data();
+    T *out = destination.data();
+    std::size_t inRow = source.getRowStride(), inColumn = source.getColumnStride();
+    std::size_t outRow = destination.getRowStride(), outColumn = destination.getColumnStride();
+
+    for (std::size_t rowBegin = 0; rowBegin < source.getRows(); rowBegin += tile)
+    {
+        std::size_t rowEnd = rowBegin + tile < source.getRows() ? rowBegin + tile : source.getRows();
+        for (std::size_t columnBegin = 0; columnBegin < source.getColumns(); columnBegin += tile)
+        {
+            std::size_t columnEnd = columnBegin + tile < source.getColumns() ? columnBegin + tile : source.getColumns();
+            for (std::size_t r = rowBegin; r < rowEnd; ++r)
+                for (std::size_t c = columnBegin; c < columnEnd; ++c)
+                    out[c * outRow + r * outColumn] = in[r * inRow + c * inColumn];
+        }
+    }
+}
+
+template <typename T, typename Accumulator, typename Combine>
+Vector<Accumulator> reduceRows(const BasicMatrixView<T> &matrix, const Accumulator &initial, Combine combine)
+{
+    Vector<Accumulator> result(matrix.getRows(), initial);
+    detail::visitInMemoryOrder(matrix, [&](std::size_t row, std::size_t, T &element) {
+        result[row] = combine(result[row], element);
+    });
+    return result;
+}
+
+template <typename T, typename Accumulator, typename Combine>
+Vector<Accumulator> reduceColumns(const BasicMatrixView<T> &matrix, const Accumulator &initial, Combine combine)
+{
+    Vector<Accumulator> result(matrix.getColumns(), initial);
+    detail::visitInMemoryOrder(matrix, [&](std::size_t, std::size_t column, T &element) {
+        result[column] = combine(result[column], element);
+    });
+    return result;
+}
+
+template <typename T>
+Vector<typename std::remove_const<T>::type> rowSums(const BasicMatrixView<T> &matrix)
+{
+    using Value = typename std::remove_const<T>::type;
+    return reduceRows(matrix, Value(), [](const Value &sum, const Value &element) { return sum + element; });
+}
+
+template <typename T>
+Vector<typename std::remove_const<T>::type> columnSums(const BasicMatrixView<T> &matrix)
+{
+    using Value = typename std::remove_const<T>::type;
+    return reduceColumns(matrix, Value(), [](const Value &sum, const Value &element) { return sum + element; });
+}
+
+/**
+ * @brief row-major matrices are multiplied a block of columns at a time, so
+ *        that the matching block of the vector stays in L1 while several
+ *        rows are dotted with it; the inner loops are plain multiply-adds
+ *        the compiler vectorises. Column-major matrices accumulate scaled
+ *        columns into the result instead.
+ */
+template <typename Matrix, typename T>
+void multiply(const BasicMatrixView<Matrix> &matrix, const Vector<T> &vector, Vector<T> &result)
+{
+    if (matrix.getColumns() != vector.getSize())
+        throw std::invalid_argument("Vector size does not match matrix columns");
+    if (&vector == &result)
+        throw std::invalid_argument("Multiplying a vector in place");
+
+    result = Vector<T>(matrix.getRows(), T());
+    const T *x = vector.data();
+    T *y = result.data();
+
+    if (matrix.isRowMajor())
+        detail::multiplyRowMajor(matrix.data(), matrix.getRows(), matrix.getColumns(), matrix.getRowStride(), x, y);
+    else if (matrix.isColumnMajor())
+        detail::multiplyColumnMajor(matrix.data(), matrix.getRows(), matrix.getColumns(), matrix.getColumnStride(), x, y);
+    else
+        detail::visitInMemoryOrder(matrix, [&](std::size_t row, std::size_t column, Matrix &element) {
+            y[row] += element * x[column];
+        });
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_MATRIX_VIEW_CPP
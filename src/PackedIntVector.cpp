@@ -0,0 +1,287 @@
+#ifndef AISDI_LINEAR_PACKED_INT_VECTOR_CPP
+#define AISDI_LINEAR_PACKED_INT_VECTOR_CPP
+
+#include "../include/PackedIntVector.hpp"
+#include "Vector.cpp"
+#include <stdexcept>
+
+namespace aisdi
+{
+
+namespace
+{
+
+inline std::uint64_t zigzagEncode(std::uint64_t current, std::uint64_t previous)
+{
+    std::int64_t delta = static_cast<std::int64_t>(current - previous);
+    return (static_cast<std::uint64_t>(delta) << 1) ^ static_cast<std::uint64_t>(delta >> 63);
+}
+
+inline std::uint64_t zigzagDecode(std::uint64_t encoded)
+{
+    return (encoded >> 1) ^ (~(encoded & 1) + 1);
+}
+
+} // namespace
+
+inline PackedIntVector::PackedIntVector(Encoding encoding)
+    : _tailSize(0), _size(0), _lastSealed(0), _encoding(encoding) {}
+
+inline PackedIntVector::PackedIntVector(std::initializer_list<value_type> l, Encoding encoding)
+    : _tailSize(0), _size(0), _lastSealed(0), _encoding(encoding)
+{
+    for (auto elem : l)
+        append(elem);
+}
+
+inline PackedIntVector::value_type PackedIntVector::operator[](const size_type index) const
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of range");
+
+    size_type blockIndex = index / BlockSize;
+    if (blockIndex == _blocks.getSize())
+        return _tail[index % BlockSize];
+
+    return decodeOne(blockIndex, index % BlockSize);
+}
+
+inline PackedIntVector::size_type PackedIntVector::getMemoryUsage() const
+{
+    return sizeof(*this) + _words.getCapacity() * sizeof(std::uint64_t) + _blocks.getCapacity() * sizeof(Block);
+}
+
+inline void PackedIntVector::append(value_type item)
+{
+    _tail[_tailSize++] = item;
+    ++_size;
+
+    if (_tailSize == BlockSize)
+        sealTail();
+}
+
+inline PackedIntVector::size_type PackedIntVector::decodeBlock(size_type blockIndex, value_type *out) const
+{
+    if (blockIndex == _blocks.getSize() && _tailSize > 0)
+    {
+        for (size_type i = 0; i < _tailSize; ++i)
+            out[i] = _tail[i];
+        return _tailSize;
+    }
+    if (blockIndex >= _blocks.getSize())
+        throw std::out_of_range("Block index out of range");
+
+    const Block &block = _blocks[blockIndex];
+    if (block.width == 0)
+    {
+        for (size_type i = 0; i < BlockSize; ++i)
+            out[i] = 0;
+    }
+    else
+        unpackBits(&_words[block.wordOffset], BlockSize, block.width, out);
+
+    switch (_encoding)
+    {
+    case Encoding::Plain:
+        break;
+    case Encoding::FrameOfReference:
+        for (size_type i = 0; i < BlockSize; ++i)
+            out[i] += block.base;
+        break;
+    case Encoding::Delta:
+    {
+        value_type previous = block.base;
+        for (size_type i = 0; i < BlockSize; ++i)
+            out[i] = previous = previous + zigzagDecode(out[i]);
+        break;
+    }
+    }
+    return BlockSize;
+}
+
+inline PackedIntVector::const_iterator PackedIntVector::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+inline PackedIntVector::const_iterator PackedIntVector::end() const
+{
+    return const_iterator(this, _size);
+}
+
+inline PackedIntVector::const_iterator PackedIntVector::cbegin() const
+{
+    return begin();
+}
+
+inline PackedIntVector::const_iterator PackedIntVector::cend() const
+{
+    return end();
+}
+
+////////////////////////////////////////////////////////////////////
+/////ITERATOR/////////
+///////////////////////////////////////////////////////////////////
+
+inline PackedIntVector::ConstIterator::ConstIterator(const PackedIntVector *vec, size_type position)
+    : _vec(vec), _position(position), _block(position / BlockSize)
+{
+    if (_position < _vec->getSize())
+        load();
+}
+
+inline PackedIntVector::ConstIterator::reference PackedIntVector::ConstIterator::operator*() const
+{
+    if (_vec == nullptr || _position >= _vec->getSize())
+        throw std::out_of_range("Dereferencing end iterator");
+
+    return _buffer[_position % BlockSize];
+}
+
+inline PackedIntVector::ConstIterator &PackedIntVector::ConstIterator::operator++()
+{
+    if (_vec == nullptr || _position >= _vec->getSize())
+        throw std::out_of_range("Incrementign end iterator");
+
+    ++_position;
+    if (_position % BlockSize == 0 && _position < _vec->getSize())
+    {
+        ++_block;
+        load();
+    }
+    return *this;
+}
+
+inline void PackedIntVector::ConstIterator::load()
+{
+    _vec->decodeBlock(_block, _buffer);
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief packs the full tail block into _words. Base and bit width are
+ *        chosen so that every stored value fits: the block minimum for
+ *        FrameOfReference, the last value of the previous block for Delta.
+ */
+inline void PackedIntVector::sealTail()
+{
+    Block block;
+    block.base = 0;
+    block.wordOffset = _words.getSize();
+
+    value_type encoded[BlockSize];
+    switch (_encoding)
+    {
+    case Encoding::Plain:
+        for (size_type i = 0; i < BlockSize; ++i)
+            encoded[i] = _tail[i];
+        break;
+    case Encoding::FrameOfReference:
+        block.base = _tail[0];
+        for (size_type i = 1; i < BlockSize; ++i)
+            if (_tail[i] < block.base)
+                block.base = _tail[i];
+        for (size_type i = 0; i < BlockSize; ++i)
+            encoded[i] = _tail[i] - block.base;
+        break;
+    case Encoding::Delta:
+        block.base = _lastSealed;
+        encoded[0] = zigzagEncode(_tail[0], block.base);
+        for (size_type i = 1; i < BlockSize; ++i)
+            encoded[i] = zigzagEncode(_tail[i], _tail[i - 1]);
+        _lastSealed = _tail[BlockSize - 1];
+        break;
+    }
+
+    value_type combined = 0;
+    for (size_type i = 0; i < BlockSize; ++i)
+        combined |= encoded[i];
+    block.width = bitWidth(combined);
+
+    packBits(encoded, BlockSize, block.width, _words);
+    _blocks.append(block);
+    _tailSize = 0;
+}
+
+/**
+ * @brief decodes a single value of a sealed block without unpacking it
+ *        whole. Delta blocks still have to sum every delta up to offset.
+ */
+inline PackedIntVector::value_type PackedIntVector::decodeOne(size_type blockIndex, size_type offset) const
+{
+    if (_encoding == Encoding::Delta)
+    {
+        value_type out[BlockSize];
+        decodeBlock(blockIndex, out);
+        return out[offset];
+    }
+
+    const Block &block = _blocks[blockIndex];
+
+    value_type value = 0;
+    if (block.width > 0)
+    {
+        const std::uint64_t *words = &_words[block.wordOffset];
+        size_type bit = offset * block.width;
+        unsigned shift = bit % 64;
+        value = words[bit / 64] >> shift;
+        if (shift + block.width > 64)
+            value |= words[bit / 64 + 1] << (64 - shift);
+        if (block.width < 64)
+            value &= (std::uint64_t(1) << block.width) - 1;
+    }
+    return value + block.base;
+}
+
+inline unsigned PackedIntVector::bitWidth(value_type value)
+{
+    return value == 0 ? 0 : 64 - __builtin_clzll(value);
+}
+
+/**
+ * @brief appends n values of 'width' bits each to out, least significant
+ *        bits first. n * width must be a multiple of 64.
+ */
+inline void PackedIntVector::packBits(const value_type *in, size_type n, unsigned width, Vector<std::uint64_t> &out)
+{
+    if (width == 0)
+        return;
+
+    std::uint64_t word = 0;
+    unsigned used = 0;
+    for (size_type i = 0; i < n; ++i)
+    {
+        word |= in[i] << used;
+        used += width;
+        if (used >= 64)
+        {
+            out.append(word);
+            used -= 64;
+            word = used > 0 ? in[i] >> (width - used) : 0;
+        }
+    }
+}
+
+/**
+ * @brief inverse of packBits, each value is read from the one or two
+ *        words its bits span.
+ */
+inline void PackedIntVector::unpackBits(const std::uint64_t *words, size_type n, unsigned width, value_type *out)
+{
+    const std::uint64_t mask = width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+    for (size_type i = 0; i < n; ++i)
+    {
+        size_type bit = i * width;
+        unsigned shift = bit % 64;
+        std::uint64_t low = words[bit / 64] >> shift;
+        std::uint64_t high = shift + width > 64 ? words[bit / 64 + 1] << (64 - shift) : 0;
+        out[i] = (low | high) & mask;
+    }
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_PACKED_INT_VECTOR_CPP
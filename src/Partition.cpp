@@ -0,0 +1,258 @@
+#ifndef AISDI_LINEAR_PARTITION_CPP
+#define AISDI_LINEAR_PARTITION_CPP
+
+#include "../include/Partition.hpp"
+#include "../include/Parallel.hpp"
+#include "Vector.cpp"
+#include <stdexcept>
+#include <utility>
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+/**
+ * Scatters items to their buckets through small per-bucket staging buffers
+ * (software write combining). A buffer holds one cache line worth of items
+ * and is copied out whole, so the destination sees full line writes instead
+ * of one scattered store per item.
+ */
+template <typename T>
+class BucketWriter
+{
+public:
+    static const std::size_t LineItems = 64 / sizeof(T) > 1 ? 64 / sizeof(T) : 1;
+
+    BucketWriter(T *destination, std::size_t *cursors, std::size_t nBuckets)
+        : _destination(destination), _cursors(cursors), _buffers(nBuckets * LineItems), _fill(nBuckets)
+    {
+    }
+
+    void write(std::size_t bucket, const T &item)
+    {
+        std::size_t &fill = _fill.data()[bucket];
+        T *buffer = _buffers.data() + bucket * LineItems;
+        buffer[fill++] = item;
+        if (fill == LineItems)
+        {
+            flush(bucket);
+        }
+    }
+
+    void flushAll()
+    {
+        for (std::size_t bucket = 0; bucket < _fill.getSize(); ++bucket)
+            flush(bucket);
+    }
+
+private:
+    T *_destination;
+    std::size_t *_cursors;
+    Vector<T> _buffers;
+    Vector<std::size_t> _fill;
+
+    void flush(std::size_t bucket)
+    {
+        std::size_t &fill = _fill.data()[bucket];
+        T *buffer = _buffers.data() + bucket * LineItems;
+        T *target = _destination + _cursors[bucket];
+        for (std::size_t i = 0; i < fill; ++i)
+            target[i] = std::move(buffer[i]);
+        _cursors[bucket] += fill;
+        fill = 0;
+    }
+};
+
+template <typename KeyFn, typename T>
+void computeBuckets(const T *items, std::size_t begin, std::size_t end, KeyFn &keyFn, std::size_t nBuckets,
+                    std::size_t *buckets)
+{
+    for (std::size_t i = begin; i < end; ++i)
+    {
+        std::size_t bucket = keyFn(items[i]);
+        if (bucket >= nBuckets)
+            throw std::out_of_range("Bucket out of range");
+        buckets[i] = bucket;
+    }
+}
+
+/**
+ * @brief one stable scatter pass over digit = (bucket >> shift) & mask.
+ *        Items and their bucket numbers are moved together. Every thread
+ *        counts digits of its own chunk; the counts give each (digit,
+ *        thread) pair its own range of the output, so a digit's items stay
+ *        in input order and the threads scatter without synchronising.
+ */
+template <typename T>
+void scatterPass(Vector<T> &items, Vector<std::size_t> &buckets, unsigned shift, std::size_t fanout,
+                 std::size_t threads)
+{
+    std::size_t size = items.getSize();
+    std::size_t mask = fanout - 1;
+    const std::size_t *keys = buckets.data();
+
+    Vector<std::size_t> cursors(threads * fanout);
+    parallel::runOnThreads(threads, [&](std::size_t thread) {
+        std::size_t begin, end;
+        parallel::chunkBounds(size, threads, thread, begin, end);
+        std::size_t *histogram = cursors.data() + thread * fanout;
+        for (std::size_t i = begin; i < end; ++i)
+            ++histogram[(keys[i] >> shift) & mask];
+    });
+
+    std::size_t start = 0;
+    for (std::size_t digit = 0; digit < fanout; ++digit)
+        for (std::size_t thread = 0; thread < threads; ++thread)
+        {
+            std::size_t &count = cursors.data()[thread * fanout + digit];
+            std::size_t cursor = start;
+            start += count;
+            count = cursor;
+        }
+
+    Vector<T> scattered;
+    scattered.resizeDefaultInit(size);
+    Vector<std::size_t> scatteredKeys;
+    scatteredKeys.resizeDefaultInit(size);
+
+    Vector<std::size_t> keyCursors(cursors);
+    parallel::runOnThreads(threads, [&](std::size_t thread) {
+        std::size_t begin, end;
+        parallel::chunkBounds(size, threads, thread, begin, end);
+        BucketWriter<T> itemWriter(scattered.data(), cursors.data() + thread * fanout, fanout);
+        BucketWriter<std::size_t> keyWriter(scatteredKeys.data(), keyCursors.data() + thread * fanout, fanout);
+        const T *source = items.data();
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            std::size_t digit = (keys[i] >> shift) & mask;
+            itemWriter.write(digit, source[i]);
+            keyWriter.write(digit, keys[i]);
+        }
+        itemWriter.flushAll();
+        keyWriter.flushAll();
+    });
+
+    items = std::move(scattered);
+    buckets = std::move(scatteredKeys);
+}
+
+/**
+ * @brief sorts items by bucket: a single pass for up to MaxFanout buckets,
+ *        otherwise stable passes over a byte of the bucket number at a
+ *        time, least significant first.
+ */
+template <typename T>
+void radixPasses(Vector<T> &items, Vector<std::size_t> &buckets, std::size_t nBuckets, std::size_t threads)
+{
+    if (nBuckets <= MaxFanout)
+    {
+        std::size_t fanout = 1;
+        while (fanout < nBuckets)
+            fanout <<= 1;
+        scatterPass(items, buckets, 0, fanout, threads);
+        return;
+    }
+
+    for (unsigned shift = 0; (nBuckets - 1) >> shift > 0; shift += 8)
+        scatterPass(items, buckets, shift, MaxFanout, threads);
+}
+
+/**
+ * @brief bucket start positions of sorted bucket numbers. A bucket starts
+ *        where the number changes, so every thread fills the offsets of the
+ *        boundaries in its chunk and no offset is written twice.
+ */
+inline Vector<std::size_t> sortedBucketOffsets(const Vector<std::size_t> &buckets, std::size_t nBuckets,
+                                               std::size_t threads)
+{
+    Vector<std::size_t> offsets;
+    offsets.resizeDefaultInit(nBuckets + 1);
+    std::size_t size = buckets.getSize();
+    const std::size_t *keys = buckets.data();
+    std::size_t *starts = offsets.data();
+
+    std::size_t first = size > 0 ? keys[0] : nBuckets;
+    std::size_t last = size > 0 ? keys[size - 1] : 0;
+    for (std::size_t bucket = 0; bucket <= first; ++bucket)
+        starts[bucket] = 0;
+    for (std::size_t bucket = last + 1; bucket <= nBuckets; ++bucket)
+        starts[bucket] = size;
+
+    parallel::runOnThreads(threads, [&](std::size_t thread) {
+        std::size_t begin, end;
+        parallel::chunkBounds(size, threads, thread, begin, end);
+        for (std::size_t i = begin > 0 ? begin : 1; i < end; ++i)
+            for (std::size_t bucket = keys[i - 1] + 1; bucket <= keys[i]; ++bucket)
+                starts[bucket] = i;
+    });
+    return offsets;
+}
+
+} // namespace detail
+
+template <typename T, typename KeyFn>
+Vector<std::size_t> partition(Vector<T> &items, KeyFn keyFn, std::size_t nBuckets)
+{
+    if (nBuckets == 0)
+        throw std::invalid_argument("Partitioning into zero buckets");
+
+    Vector<std::size_t> buckets;
+    buckets.resizeDefaultInit(items.getSize());
+    detail::computeBuckets(items.data(), 0, items.getSize(), keyFn, nBuckets, buckets.data());
+
+    detail::radixPasses(items, buckets, nBuckets, 1);
+    return detail::sortedBucketOffsets(buckets, nBuckets, 1);
+}
+
+/**
+ * @brief every thread computes the buckets of its own chunk, then the
+ *        passes of partition run with every thread scattering its chunk,
+ *        so staging and histograms stay at MaxFanout per thread however
+ *        many buckets there are. Items of a bucket stay in input order.
+ */
+template <typename T, typename KeyFn>
+Vector<std::size_t> parallelPartition(Vector<T> &items, KeyFn keyFn, std::size_t nBuckets, std::size_t threads)
+{
+    if (nBuckets == 0)
+        throw std::invalid_argument("Partitioning into zero buckets");
+    if (threads == 0)
+        threads = parallel::defaultThreadCount();
+
+    std::size_t size = items.getSize();
+    if (threads > size / 1024 + 1)
+        threads = size / 1024 + 1;
+
+    Vector<std::size_t> buckets;
+    buckets.resizeDefaultInit(size);
+    parallel::runOnThreads(threads, [&](std::size_t thread) {
+        std::size_t begin, end;
+        parallel::chunkBounds(size, threads, thread, begin, end);
+        KeyFn localKeyFn = keyFn;
+        detail::computeBuckets(items.data(), begin, end, localKeyFn, nBuckets, buckets.data());
+    });
+
+    detail::radixPasses(items, buckets, nBuckets, threads);
+    return detail::sortedBucketOffsets(buckets, nBuckets, threads);
+}
+
+template <typename T, typename KeyFn, typename A, typename Combine>
+Vector<A> groupAggregate(Vector<T> &items, KeyFn keyFn, std::size_t nBuckets, const A &initial, Combine combine)
+{
+    Vector<std::size_t> offsets = partition(items, keyFn, nBuckets);
+    Vector<A> result(nBuckets, initial);
+
+    const T *source = items.data();
+    for (std::size_t bucket = 0; bucket < nBuckets; ++bucket)
+    {
+        A &accumulator = result[bucket];
+        for (std::size_t i = offsets[bucket]; i < offsets[bucket + 1]; ++i)
+            accumulator = combine(accumulator, source[i]);
+    }
+    return result;
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_PARTITION_CPP
@@ -0,0 +1,271 @@
+#ifndef AISDI_LINEAR_REDUCED_FLOAT_VECTOR_CPP
+#define AISDI_LINEAR_REDUCED_FLOAT_VECTOR_CPP
+
+#include "../include/ReducedFloatVector.hpp"
+#include "Vector.cpp"
+#include <cstring>
+#include <stdexcept>
+
+#ifdef __F16C__
+#include <immintrin.h>
+#endif
+
+namespace aisdi
+{
+
+namespace
+{
+
+inline std::uint32_t floatBits(float value)
+{
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float bitsFloat(std::uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+} // namespace
+
+/**
+ * @brief normal results rebias the exponent and round on the 13 dropped
+ *        mantissa bits; results below the smallest normal half are rounded
+ *        by the FPU, adding 0.5 puts the half subnormal unit 2^-24 in the
+ *        last mantissa bit of the sum.
+ */
+inline std::uint16_t Float16::fromFloat(float value)
+{
+    std::uint32_t bits = floatBits(value);
+    std::uint16_t sign = static_cast<std::uint16_t>((bits >> 16) & 0x8000);
+    bits &= 0x7fffffff;
+
+    if (bits >= 0x7f800000) // infinity or NaN
+        return sign | (bits > 0x7f800000 ? 0x7e00 : 0x7c00);
+    if (bits >= 0x477ff000) // rounds past 65504
+        return sign | 0x7c00;
+    if (bits < 0x38800000) // below 2^-14
+        return sign | static_cast<std::uint16_t>(floatBits(bitsFloat(bits) + 0.5f) - floatBits(0.5f));
+
+    std::uint32_t odd = (bits >> 13) & 1;
+    bits += 0xc8000fff + odd; // exponent bias 127 -> 15, plus round to nearest even
+    return sign | static_cast<std::uint16_t>(bits >> 13);
+}
+
+inline float Float16::toFloat(std::uint16_t bits)
+{
+    std::uint32_t sign = static_cast<std::uint32_t>(bits & 0x8000) << 16;
+    std::uint32_t exponent = (bits >> 10) & 0x1f;
+    std::uint32_t mantissa = bits & 0x3ff;
+
+    if (exponent == 0x1f)
+        return bitsFloat(sign | 0x7f800000 | (mantissa << 13));
+    if (exponent == 0)
+        return bitsFloat(sign | floatBits(static_cast<float>(mantissa) * 5.9604645e-8f)); // mantissa * 2^-24
+
+    return bitsFloat(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+inline void Float16::fromFloats(const float *in, std::uint16_t *out, std::size_t count)
+{
+    std::size_t i = 0;
+#ifdef __F16C__
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), half);
+    }
+#endif
+    for (; i < count; ++i)
+        out[i] = fromFloat(in[i]);
+}
+
+inline void Float16::toFloats(const std::uint16_t *in, float *out, std::size_t count)
+{
+    std::size_t i = 0;
+#ifdef __F16C__
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+    }
+#endif
+    for (; i < count; ++i)
+        out[i] = toFloat(in[i]);
+}
+
+inline std::uint16_t BFloat16::fromFloat(float value)
+{
+    std::uint32_t bits = floatBits(value);
+    if ((bits & 0x7fffffff) > 0x7f800000)
+        return static_cast<std::uint16_t>((bits >> 16) | 0x40); // keep NaN quiet
+
+    bits += 0x7fff + ((bits >> 16) & 1);
+    return static_cast<std::uint16_t>(bits >> 16);
+}
+
+inline float BFloat16::toFloat(std::uint16_t bits)
+{
+    return bitsFloat(static_cast<std::uint32_t>(bits) << 16);
+}
+
+// both loops are plain integer arithmetic the compiler vectorises
+inline void BFloat16::fromFloats(const float *in, std::uint16_t *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = fromFloat(in[i]);
+}
+
+inline void BFloat16::toFloats(const std::uint16_t *in, float *out, std::size_t count)
+{
+    for (std::size_t i = 0; i < count; ++i)
+        out[i] = toFloat(in[i]);
+}
+
+namespace detail
+{
+
+const std::size_t ReduceLanes = 8;
+
+// lanes[j] += a[i] * b[i] for i = j mod ReduceLanes; independent lanes let
+// the compiler keep the partial sums in one vector register
+inline void dotLanes(const float *a, const float *b, std::size_t count, float *lanes)
+{
+    std::size_t i = 0;
+    for (; i + ReduceLanes <= count; i += ReduceLanes)
+        for (std::size_t j = 0; j < ReduceLanes; ++j)
+            lanes[j] += a[i + j] * b[i + j];
+    for (; i < count; ++i)
+        lanes[0] += a[i] * b[i];
+}
+
+inline void sumLanes(const float *a, std::size_t count, float *lanes)
+{
+    std::size_t i = 0;
+    for (; i + ReduceLanes <= count; i += ReduceLanes)
+        for (std::size_t j = 0; j < ReduceLanes; ++j)
+            lanes[j] += a[i + j];
+    for (; i < count; ++i)
+        lanes[0] += a[i];
+}
+
+inline float addLanes(const float *lanes)
+{
+    float total = 0.0f;
+    for (std::size_t j = 0; j < ReduceLanes; ++j)
+        total += lanes[j];
+    return total;
+}
+
+} // namespace detail
+
+template <typename F>
+BasicReducedFloatVector<F>::BasicReducedFloatVector(std::initializer_list<float> l)
+{
+    appendRange(l.begin(), l.size());
+}
+
+template <typename F>
+BasicReducedFloatVector<F>::BasicReducedFloatVector(const Vector<float> &values)
+{
+    appendRange(values.data(), values.getSize());
+}
+
+template <typename F>
+float BasicReducedFloatVector<F>::operator[](const size_type index) const
+{
+    return F::toFloat(_bits[index]);
+}
+
+template <typename F>
+void BasicReducedFloatVector<F>::set(const size_type index, float value)
+{
+    _bits[index] = F::fromFloat(value);
+}
+
+template <typename F>
+void BasicReducedFloatVector<F>::append(float value)
+{
+    _bits.append(F::fromFloat(value));
+}
+
+template <typename F>
+void BasicReducedFloatVector<F>::appendRange(const float *values, size_type count)
+{
+    size_type size = _bits.getSize();
+    _bits.resizeDefaultInit(size + count);
+    F::fromFloats(values, _bits.data() + size, count);
+}
+
+template <typename F>
+void BasicReducedFloatVector<F>::decode(Vector<float> &out) const
+{
+    out.resizeDefaultInit(_bits.getSize());
+    F::toFloats(_bits.data(), out.data(), _bits.getSize());
+}
+
+template <typename F>
+float BasicReducedFloatVector<F>::sum() const
+{
+    float lanes[detail::ReduceLanes] = {};
+    forEachBlock([&lanes](size_type, const float *block, size_type count) {
+        detail::sumLanes(block, count, lanes);
+    });
+    return detail::addLanes(lanes);
+}
+
+template <typename F>
+float BasicReducedFloatVector<F>::dot(const Vector<float> &other) const
+{
+    if (other.getSize() != getSize())
+        throw std::invalid_argument("Dot product of vectors of different size");
+
+    float lanes[detail::ReduceLanes] = {};
+    const float *values = other.data();
+    forEachBlock([&lanes, values](size_type begin, const float *block, size_type count) {
+        detail::dotLanes(block, values + begin, count, lanes);
+    });
+    return detail::addLanes(lanes);
+}
+
+template <typename F>
+float BasicReducedFloatVector<F>::dot(const BasicReducedFloatVector &other) const
+{
+    if (other.getSize() != getSize())
+        throw std::invalid_argument("Dot product of vectors of different size");
+
+    float lanes[detail::ReduceLanes] = {};
+    float decoded[_block];
+    const std::uint16_t *bits = other._bits.data();
+    forEachBlock([&lanes, &decoded, bits](size_type begin, const float *block, size_type count) {
+        F::toFloats(bits + begin, decoded, count);
+        detail::dotLanes(block, decoded, count, lanes);
+    });
+    return detail::addLanes(lanes);
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+// calls visit(begin, decoded, count) for consecutive blocks of _block elements
+template <typename F>
+template <typename Visit>
+void BasicReducedFloatVector<F>::forEachBlock(Visit visit) const
+{
+    float decoded[_block];
+    for (size_type begin = 0; begin < _bits.getSize(); begin += _block)
+    {
+        size_type count = _bits.getSize() - begin < _block ? _bits.getSize() - begin : _block;
+        F::toFloats(_bits.data() + begin, decoded, count);
+        visit(begin, decoded, count);
+    }
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_REDUCED_FLOAT_VECTOR_CPP
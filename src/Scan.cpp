@@ -0,0 +1,267 @@
+#ifndef AISDI_LINEAR_SCAN_CPP
+#define AISDI_LINEAR_SCAN_CPP
+
+#include "../include/Scan.hpp"
+#include "../include/Parallel.hpp"
+#include "Vector.cpp"
+#include <cstdint>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+const std::size_t MinScanChunk = 1 << 16;
+
+template <typename T>
+T scanSerial(const T *in, T *out, std::size_t size, T carry)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        carry = carry + in[i];
+        out[i] = carry;
+    }
+    return carry;
+}
+
+template <typename T>
+T exclusiveSerial(const T *in, T *out, std::size_t size, T carry)
+{
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        T item = in[i]; // read before the write, in may be out
+        out[i] = carry;
+        carry = carry + item;
+    }
+    return carry;
+}
+
+#ifdef __SSE2__
+/**
+ * @brief in-register scan of 32 bit integers, four per step: two shifted
+ *        adds give the prefix sums of a register, then the running total of
+ *        previous registers is added to all lanes.
+ */
+template <typename T>
+T scanLanes(const T *in, T *out, std::size_t size, T carry, std::integral_constant<std::size_t, 4>)
+{
+    std::size_t i = 0;
+    __m128i total = _mm_set1_epi32(static_cast<int>(carry));
+    for (; i + 4 <= size; i += 4)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, total);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), x);
+        total = _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3));
+    }
+    carry = static_cast<T>(_mm_cvtsi128_si32(total));
+    return scanSerial(in + i, out + i, size - i, carry);
+}
+
+// the same for 64 bit integers, two per step
+template <typename T>
+T scanLanes(const T *in, T *out, std::size_t size, T carry, std::integral_constant<std::size_t, 8>)
+{
+    std::size_t i = 0;
+    __m128i total = _mm_set1_epi64x(static_cast<long long>(carry));
+    for (; i + 2 <= size; i += 2)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi64(x, total);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), x);
+        total = _mm_unpackhi_epi64(x, x);
+    }
+    carry = static_cast<T>(_mm_cvtsi128_si64(total));
+    return scanSerial(in + i, out + i, size - i, carry);
+}
+
+/**
+ * @brief exclusive counterparts: the register's prefix sums are shifted up
+ *        one lane before the running total is added, the total then grows
+ *        by the register's last prefix sum.
+ */
+template <typename T>
+T exclusiveLanes(const T *in, T *out, std::size_t size, T carry, std::integral_constant<std::size_t, 4>)
+{
+    std::size_t i = 0;
+    __m128i total = _mm_set1_epi32(static_cast<int>(carry));
+    for (; i + 4 <= size; i += 4)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_add_epi32(_mm_slli_si128(x, 4), total));
+        total = _mm_add_epi32(total, _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+    carry = static_cast<T>(_mm_cvtsi128_si32(total));
+    return exclusiveSerial(in + i, out + i, size - i, carry);
+}
+
+template <typename T>
+T exclusiveLanes(const T *in, T *out, std::size_t size, T carry, std::integral_constant<std::size_t, 8>)
+{
+    std::size_t i = 0;
+    __m128i total = _mm_set1_epi64x(static_cast<long long>(carry));
+    for (; i + 2 <= size; i += 2)
+    {
+        __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + i));
+        x = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_add_epi64(_mm_slli_si128(x, 8), total));
+        total = _mm_add_epi64(total, _mm_unpackhi_epi64(x, x));
+    }
+    carry = static_cast<T>(_mm_cvtsi128_si64(total));
+    return exclusiveSerial(in + i, out + i, size - i, carry);
+}
+#endif
+
+template <typename T, std::size_t Width>
+T scanLanes(const T *in, T *out, std::size_t size, T carry, std::integral_constant<std::size_t, Width>)
+{
+    return scanSerial(in, out, size, carry);
+}
+
+template <typename T, std::size_t Width>
+T exclusiveLanes(const T *in, T *out, std::size_t size, T carry, std::integral_constant<std::size_t, Width>)
+{
+    return exclusiveSerial(in, out, size, carry);
+}
+
+/**
+ * @brief inclusive scan of size elements starting from carry, returns the
+ *        last sum. in and out may be the same array. Integers go through
+ *        the SSE2 kernels, everything else through the serial loop.
+ */
+template <typename T>
+T scanBlock(const T *in, T *out, std::size_t size, T carry)
+{
+    const std::size_t width = std::is_integral<T>::value ? sizeof(T) : 0;
+    return scanLanes(in, out, size, carry, std::integral_constant<std::size_t, width>());
+}
+
+// exclusive scan of size elements starting from carry, returns the total
+template <typename T>
+T exclusiveBlock(const T *in, T *out, std::size_t size, T carry)
+{
+    const std::size_t width = std::is_integral<T>::value ? sizeof(T) : 0;
+    return exclusiveLanes(in, out, size, carry, std::integral_constant<std::size_t, width>());
+}
+
+// one chunk of a scan, inclusive or exclusive
+template <typename T>
+void scanChunk(T *values, std::size_t size, T carry, bool exclusive)
+{
+    if (exclusive)
+        exclusiveBlock(values, values, size, carry);
+    else
+        scanBlock(values, values, size, carry);
+}
+
+template <typename T>
+T sumBlock(const T *in, std::size_t size)
+{
+    T sum = T();
+    for (std::size_t i = 0; i < size; ++i)
+        sum = sum + in[i];
+    return sum;
+}
+
+/**
+ * @brief two pass block scan: every thread sums its chunk, the chunk sums
+ *        are scanned serially, then every thread scans its chunk starting
+ *        from the sum of the chunks before it, writing the exclusive
+ *        result directly when asked to.
+ */
+template <typename T>
+void parallelScan(T *values, std::size_t size, T initial, std::size_t threads, bool exclusive)
+{
+    if (threads == 0)
+        threads = parallel::defaultThreadCount();
+    if (threads > size / MinScanChunk)
+        threads = size / MinScanChunk > 0 ? size / MinScanChunk : 1;
+
+    if (threads == 1)
+    {
+        scanChunk(values, size, initial, exclusive);
+        return;
+    }
+
+    Vector<T> carries(threads);
+    parallel::runOnThreads(threads, [&](std::size_t thread) {
+        std::size_t begin, end;
+        parallel::chunkBounds(size, threads, thread, begin, end);
+        carries[thread] = sumBlock(values + begin, end - begin);
+    });
+
+    T carry = initial;
+    for (std::size_t thread = 0; thread < threads; ++thread)
+    {
+        T sum = carries[thread];
+        carries[thread] = carry;
+        carry = carry + sum;
+    }
+
+    parallel::runOnThreads(threads, [&](std::size_t thread) {
+        std::size_t begin, end;
+        parallel::chunkBounds(size, threads, thread, begin, end);
+        scanChunk(values + begin, end - begin, carries[thread], exclusive);
+    });
+}
+
+} // namespace detail
+
+template <typename T>
+void inclusiveScan(Vector<T> &values)
+{
+    detail::scanBlock(values.data(), values.data(), values.getSize(), T());
+}
+
+template <typename T>
+void inclusiveScan(const Vector<T> &in, Vector<T> &out)
+{
+    if (&in == &out)
+        return inclusiveScan(out);
+
+    out.resizeDefaultInit(in.getSize());
+    detail::scanBlock(in.data(), out.data(), in.getSize(), T());
+}
+
+template <typename T>
+void exclusiveScan(Vector<T> &values, const T &initial)
+{
+    detail::exclusiveBlock(values.data(), values.data(), values.getSize(), initial);
+}
+
+template <typename T>
+void exclusiveScan(const Vector<T> &in, Vector<T> &out, const T &initial)
+{
+    if (&in == &out)
+        return exclusiveScan(out, initial);
+
+    out.resizeDefaultInit(in.getSize());
+    detail::exclusiveBlock(in.data(), out.data(), in.getSize(), initial);
+}
+
+template <typename T>
+void parallelInclusiveScan(Vector<T> &values, std::size_t threads)
+{
+    detail::parallelScan(values.data(), values.getSize(), T(), threads, false);
+}
+
+template <typename T>
+void parallelExclusiveScan(Vector<T> &values, const T &initial, std::size_t threads)
+{
+    detail::parallelScan(values.data(), values.getSize(), initial, threads, true);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SCAN_CPP
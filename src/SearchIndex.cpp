@@ -0,0 +1,129 @@
+#ifndef AISDI_LINEAR_SEARCH_INDEX_CPP
+#define AISDI_LINEAR_SEARCH_INDEX_CPP
+
+#include "../include/SearchIndex.hpp"
+#include "Vector.cpp"
+
+namespace aisdi
+{
+
+template <typename T>
+SearchIndex<T>::SearchIndex(const Vector<T> &sorted)
+{
+    for (size_type i = 1; i < sorted.getSize(); ++i)
+        if (sorted[i] < sorted[i - 1])
+            throw std::invalid_argument("Building search index from unsorted vector");
+
+    if (sorted.isEmpty())
+        return;
+
+    _keys.resizeDefaultInit(sorted.getSize() + 1);
+    _ranks.resizeDefaultInit(sorted.getSize() + 1);
+    build(sorted, 0, 1);
+}
+
+template <typename T>
+typename SearchIndex<T>::size_type SearchIndex<T>::lowerBound(const T &key) const
+{
+    size_type slot = descend(key);
+    return slot == 0 ? getSize() : _ranks[slot];
+}
+
+template <typename T>
+bool SearchIndex<T>::contains(const T &key) const
+{
+    size_type slot = descend(key);
+    return slot != 0 && !(key < _keys[slot]);
+}
+
+template <typename T>
+void SearchIndex<T>::lowerBounds(const Vector<T> &keys, Vector<size_type> &positions) const
+{
+    positions.resizeDefaultInit(keys.getSize());
+    const T *tree = _keys.data();
+    const T *queries = keys.data();
+    size_type *out = positions.data();
+    size_type size = getSize();
+
+    for (size_type begin = 0; begin < keys.getSize(); begin += _batch)
+    {
+        size_type count = keys.getSize() - begin < _batch ? keys.getSize() - begin : _batch;
+        size_type slots[_batch];
+        for (size_type i = 0; i < count; ++i)
+            slots[i] = 1;
+
+        bool active = size > 0;
+        while (active)
+        {
+            active = false;
+            for (size_type i = 0; i < count; ++i)
+            {
+                if (slots[i] > size)
+                    continue;
+                __builtin_prefetch(tree + slots[i] * _prefetchStride);
+                slots[i] = 2 * slots[i] + (tree[slots[i]] < queries[begin + i]);
+                active |= slots[i] <= size;
+            }
+        }
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            size_type slot = lastNotLess(slots[i]);
+            out[begin + i] = slot == 0 ? size : _ranks[slot];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief fills the subtree rooted at slot with sorted[next...] by an in
+ *        order walk, returns the next unused position of sorted.
+ */
+template <typename T>
+typename SearchIndex<T>::size_type SearchIndex<T>::build(const Vector<T> &sorted, size_type next, size_type slot)
+{
+    if (slot >= _keys.getSize())
+        return next;
+
+    next = build(sorted, next, 2 * slot);
+    _keys[slot] = sorted[next];
+    _ranks[slot] = next;
+    return build(sorted, next + 1, 2 * slot + 1);
+}
+
+/**
+ * @brief branchless descent: every level goes left or right by adding the
+ *        comparison result, which leaves the path taken in the bits of slot.
+ */
+template <typename T>
+typename SearchIndex<T>::size_type SearchIndex<T>::descend(const T &key) const
+{
+    const T *keys = _keys.data();
+    size_type size = getSize();
+    size_type slot = 1;
+    while (slot <= size)
+    {
+        __builtin_prefetch(keys + slot * _prefetchStride);
+        slot = 2 * slot + (keys[slot] < key);
+    }
+    return lastNotLess(slot);
+}
+
+/**
+ * @brief turns the slot a descent left the tree at into the slot of the
+ *        first key not less than the query, 0 when there is none. The
+ *        trailing ones of slot are the right turns taken after the last left
+ *        one; dropping them and that left turn gives its parent.
+ */
+template <typename T>
+typename SearchIndex<T>::size_type SearchIndex<T>::lastNotLess(size_type slot)
+{
+    return slot >> __builtin_ffsll(static_cast<long long>(~slot));
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SEARCH_INDEX_CPP
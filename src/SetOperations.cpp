@@ -0,0 +1,349 @@
+#ifndef AISDI_LINEAR_SET_OPERATIONS_CPP
+#define AISDI_LINEAR_SET_OPERATIONS_CPP
+
+#include "../include/SetOperations.hpp"
+#include "Vector.cpp"
+#include <algorithm>
+#include <type_traits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace aisdi
+{
+
+namespace detail
+{
+
+// inputs at least this many times longer than the other one are galloped
+const std::size_t SkewRatio = 32;
+
+template <typename T>
+struct WriteSink
+{
+    T *out;
+    std::size_t count;
+
+    void add(const T &item) { out[count++] = item; }
+
+    void addRange(const T *first, const T *last)
+    {
+        while (first != last)
+            out[count++] = *first++;
+    }
+
+    // adds block[i] for every bit i set in mask
+    void addMasked(const T *block, unsigned mask)
+    {
+        for (; mask != 0; mask &= mask - 1)
+            out[count++] = block[__builtin_ctz(mask)];
+    }
+};
+
+template <typename T>
+struct CountSink
+{
+    std::size_t count;
+
+    void add(const T &) { ++count; }
+    void addRange(const T *first, const T *last) { count += last - first; }
+    void addMasked(const T *, unsigned mask) { count += __builtin_popcount(mask); }
+};
+
+/**
+ * @brief first position in [first, last) where skip(element) is false,
+ *        skip being true on a prefix. Probes 1, 2, 4... elements ahead, then
+ *        binary searches the last step, so the cost grows with the log of
+ *        the distance rather than of the length.
+ */
+template <typename T, typename Skip>
+const T *gallop(const T *first, const T *last, Skip skip)
+{
+    if (first == last || !skip(*first))
+        return first;
+
+    std::size_t step = 1;
+    while (static_cast<std::size_t>(last - first) > step && skip(first[step]))
+    {
+        first += step;
+        step *= 2;
+    }
+    const T *high = static_cast<std::size_t>(last - first) > step ? first + step : last;
+    return std::partition_point(first + 1, high, skip);
+}
+
+template <typename T, typename Sink>
+void intersectLinear(const T *a, std::size_t aSize, const T *b, std::size_t bSize, Sink &sink)
+{
+    std::size_t i = 0, j = 0;
+    while (i < aSize && j < bSize)
+    {
+        if (a[i] < b[j])
+            ++i;
+        else if (b[j] < a[i])
+            ++j;
+        else
+        {
+            sink.add(a[i]);
+            ++i;
+            ++j;
+        }
+    }
+}
+
+#ifdef __SSE2__
+/**
+ * @brief compares a block of four elements of a with all four rotations of
+ *        a block of b, the combined equality mask selects the common
+ *        elements. The block with the smaller last element is done.
+ */
+template <typename T, typename Sink>
+void intersectBlocks(const T *a, std::size_t aSize, const T *b, std::size_t bSize, Sink &sink, std::true_type)
+{
+    std::size_t i = 0, j = 0;
+    while (i + 4 <= aSize && j + 4 <= bSize)
+    {
+        __m128i blockA = _mm_loadu_si128(reinterpret_cast<const __m128i *>(a + i));
+        __m128i blockB = _mm_loadu_si128(reinterpret_cast<const __m128i *>(b + j));
+        __m128i equal = _mm_cmpeq_epi32(blockA, blockB);
+        equal = _mm_or_si128(equal, _mm_cmpeq_epi32(blockA, _mm_shuffle_epi32(blockB, _MM_SHUFFLE(0, 3, 2, 1))));
+        equal = _mm_or_si128(equal, _mm_cmpeq_epi32(blockA, _mm_shuffle_epi32(blockB, _MM_SHUFFLE(1, 0, 3, 2))));
+        equal = _mm_or_si128(equal, _mm_cmpeq_epi32(blockA, _mm_shuffle_epi32(blockB, _MM_SHUFFLE(2, 1, 0, 3))));
+        sink.addMasked(a + i, static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(equal))));
+
+        T lastA = a[i + 3], lastB = b[j + 3];
+        if (!(lastB < lastA))
+            i += 4;
+        if (!(lastA < lastB))
+            j += 4;
+    }
+    intersectLinear(a + i, aSize - i, b + j, bSize - j, sink);
+}
+#endif
+
+template <typename T, typename Sink, typename Vectorised>
+void intersectBlocks(const T *a, std::size_t aSize, const T *b, std::size_t bSize, Sink &sink, Vectorised)
+{
+    intersectLinear(a, aSize, b, bSize, sink);
+}
+
+template <typename T, typename Sink>
+void intersect(const T *a, std::size_t aSize, const T *b, std::size_t bSize, Sink &sink)
+{
+    if (aSize > bSize)
+    {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+
+    if (bSize / SkewRatio >= aSize)
+    {
+        const T *position = b, *end = b + bSize;
+        for (std::size_t i = 0; i < aSize && position != end; ++i)
+        {
+            const T &item = a[i];
+            position = gallop(position, end, [&item](const T &other) { return other < item; });
+            if (position != end && !(item < *position))
+                sink.add(*position++);
+        }
+        return;
+    }
+
+    using Vectorised = std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) == 4>;
+    intersectBlocks(a, aSize, b, bSize, sink, Vectorised());
+}
+
+template <typename T, typename Sink>
+void unite(const T *a, std::size_t aSize, const T *b, std::size_t bSize, Sink &sink)
+{
+    if (aSize > bSize)
+    {
+        std::swap(a, b);
+        std::swap(aSize, bSize);
+    }
+
+    if (bSize / SkewRatio >= aSize)
+    {
+        const T *position = b, *end = b + bSize;
+        for (std::size_t i = 0; i < aSize; ++i)
+        {
+            const T &item = a[i];
+            const T *next = gallop(position, end, [&item](const T &other) { return other < item; });
+            sink.addRange(position, next);
+            position = next != end && !(item < *next) ? next + 1 : next;
+            sink.add(item);
+        }
+        sink.addRange(position, end);
+        return;
+    }
+
+    std::size_t i = 0, j = 0;
+    while (i < aSize && j < bSize)
+    {
+        if (a[i] < b[j])
+            sink.add(a[i++]);
+        else if (b[j] < a[i])
+            sink.add(b[j++]);
+        else
+        {
+            sink.add(a[i++]);
+            ++j;
+        }
+    }
+    sink.addRange(a + i, a + aSize);
+    sink.addRange(b + j, b + bSize);
+}
+
+template <typename T, typename Sink>
+void subtract(const T *a, std::size_t aSize, const T *b, std::size_t bSize, Sink &sink)
+{
+    const T *position = a, *end = a + aSize;
+
+    if (bSize / SkewRatio >= aSize)
+    {
+        const T *other = b, *otherEnd = b + bSize;
+        for (; position != end; ++position)
+        {
+            const T &item = *position;
+            other = gallop(other, otherEnd, [&item](const T &element) { return element < item; });
+            if (other == otherEnd || item < *other)
+                sink.add(item);
+        }
+        return;
+    }
+
+    if (aSize / SkewRatio >= bSize)
+    {
+        for (std::size_t j = 0; j < bSize; ++j)
+        {
+            const T &item = b[j];
+            const T *next = gallop(position, end, [&item](const T &element) { return element < item; });
+            sink.addRange(position, next);
+            position = next != end && !(item < *next) ? next + 1 : next;
+        }
+        sink.addRange(position, end);
+        return;
+    }
+
+    std::size_t j = 0;
+    for (; position != end && j < bSize;)
+    {
+        if (*position < b[j])
+            sink.add(*position++);
+        else if (b[j] < *position)
+            ++j;
+        else
+        {
+            ++position;
+            ++j;
+        }
+    }
+    sink.addRange(position, end);
+}
+
+/**
+ * @brief stable merge. A much shorter input is inserted into the longer
+ *        one by galloping to the insertion point of each of its elements.
+ */
+template <typename T, typename Sink>
+void mergeInto(const T *a, std::size_t aSize, const T *b, std::size_t bSize, Sink &sink)
+{
+    if (bSize / SkewRatio >= aSize || aSize / SkewRatio >= bSize)
+    {
+        bool aShort = aSize <= bSize;
+        const T *shortInput = aShort ? a : b, *position = aShort ? b : a;
+        const T *end = aShort ? b + bSize : a + aSize;
+        std::size_t shortSize = aShort ? aSize : bSize;
+        for (std::size_t i = 0; i < shortSize; ++i)
+        {
+            const T &item = shortInput[i];
+            // equal elements of a go first
+            const T *next = aShort ? gallop(position, end, [&item](const T &other) { return other < item; })
+                                   : gallop(position, end, [&item](const T &other) { return !(item < other); });
+            sink.addRange(position, next);
+            sink.add(item);
+            position = next;
+        }
+        sink.addRange(position, end);
+        return;
+    }
+
+    std::size_t i = 0, j = 0;
+    while (i < aSize && j < bSize)
+    {
+        if (b[j] < a[i])
+            sink.add(b[j++]);
+        else
+            sink.add(a[i++]);
+    }
+    sink.addRange(a + i, a + aSize);
+    sink.addRange(b + j, b + bSize);
+}
+
+/**
+ * @brief sizes out for the largest possible result, lets operation write
+ *        into it and trims it to what was written.
+ */
+template <typename T, typename Operation>
+void writeResult(const Vector<T> &a, const Vector<T> &b, Vector<T> &out, std::size_t bound, Operation operation)
+{
+    if (&out == &a || &out == &b)
+        throw std::invalid_argument("Set operation output aliases an input");
+
+    out.resizeDefaultInit(bound);
+    WriteSink<T> sink = {out.data(), 0};
+    operation(a.data(), a.getSize(), b.data(), b.getSize(), sink);
+    out.resize(sink.count);
+}
+
+} // namespace detail
+
+template <typename T>
+void setIntersect(const Vector<T> &a, const Vector<T> &b, Vector<T> &out)
+{
+    std::size_t bound = a.getSize() < b.getSize() ? a.getSize() : b.getSize();
+    detail::writeResult(a, b, out, bound, detail::intersect<T, detail::WriteSink<T>>);
+}
+
+template <typename T>
+void setUnion(const Vector<T> &a, const Vector<T> &b, Vector<T> &out)
+{
+    detail::writeResult(a, b, out, a.getSize() + b.getSize(), detail::unite<T, detail::WriteSink<T>>);
+}
+
+template <typename T>
+void setDifference(const Vector<T> &a, const Vector<T> &b, Vector<T> &out)
+{
+    detail::writeResult(a, b, out, a.getSize(), detail::subtract<T, detail::WriteSink<T>>);
+}
+
+template <typename T>
+void merge(const Vector<T> &a, const Vector<T> &b, Vector<T> &out)
+{
+    detail::writeResult(a, b, out, a.getSize() + b.getSize(), detail::mergeInto<T, detail::WriteSink<T>>);
+}
+
+template <typename T>
+std::size_t countIntersect(const Vector<T> &a, const Vector<T> &b)
+{
+    detail::CountSink<T> sink = {0};
+    detail::intersect(a.data(), a.getSize(), b.data(), b.getSize(), sink);
+    return sink.count;
+}
+
+template <typename T>
+std::size_t countUnion(const Vector<T> &a, const Vector<T> &b)
+{
+    return a.getSize() + b.getSize() - countIntersect(a, b);
+}
+
+template <typename T>
+std::size_t countDifference(const Vector<T> &a, const Vector<T> &b)
+{
+    return a.getSize() - countIntersect(a, b);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SET_OPERATIONS_CPP
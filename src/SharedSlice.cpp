@@ -0,0 +1,52 @@
+#ifndef AISDI_LINEAR_SHARED_SLICE_CPP
+#define AISDI_LINEAR_SHARED_SLICE_CPP
+
+#include "../include/SharedSlice.hpp"
+#include "Vector.cpp"
+#include <stdexcept>
+
+namespace aisdi
+{
+
+/**
+ * @brief takes the buffer of vec without copying, vec is left empty.
+ */
+template <typename T>
+SharedSlice<T>::SharedSlice(Vector<T> &&vec) : _data(nullptr), _size(0)
+{
+    typename Vector<T>::Buffer buffer = vec.release();
+    if (buffer.data == nullptr)
+        return;
+
+    size_type capacity = buffer.capacity;
+    typename Vector<T>::Deleter deleter = buffer.deleter;
+    _owner = std::shared_ptr<T>(buffer.data, [capacity, deleter](T *data) { deleter(data, capacity); });
+    _data = buffer.data;
+    _size = buffer.size;
+}
+
+template <typename T>
+T &SharedSlice<T>::operator[](const size_type index) const
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of range");
+
+    return _data[index];
+}
+
+template <typename T>
+SharedSlice<T> SharedSlice<T>::slice(size_type from, size_type to) const
+{
+    if (from > to || to > _size)
+        throw std::out_of_range("Slice out of range");
+
+    SharedSlice<T> result;
+    result._owner = _owner;
+    result._data = _data + from;
+    result._size = to - from;
+    return result;
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SHARED_SLICE_CPP
@@ -0,0 +1,157 @@
+#ifndef AISDI_LINEAR_SLOT_MAP_CPP
+#define AISDI_LINEAR_SLOT_MAP_CPP
+
+#include "../include/SlotMap.hpp"
+#include "Vector.cpp"
+#include <utility>
+
+namespace aisdi
+{
+
+template <typename T>
+T &SlotMap<T>::operator[](const Handle &handle)
+{
+    T *item = find(handle);
+    if (item == nullptr)
+        throw std::out_of_range("Stale slot map handle");
+    return *item;
+}
+
+template <typename T>
+const T &SlotMap<T>::operator[](const Handle &handle) const
+{
+    const T *item = find(handle);
+    if (item == nullptr)
+        throw std::out_of_range("Stale slot map handle");
+    return *item;
+}
+
+template <typename T>
+T *SlotMap<T>::find(const Handle &handle)
+{
+    const Slot *slot = findSlot(handle);
+    return slot == nullptr ? nullptr : _values.data() + slot->target;
+}
+
+template <typename T>
+const T *SlotMap<T>::find(const Handle &handle) const
+{
+    const Slot *slot = findSlot(handle);
+    return slot == nullptr ? nullptr : _values.data() + slot->target;
+}
+
+/**
+ * @brief stores a copy of item, reusing the most recently freed slot.
+ *        Throws std::length_error once 2^32 - 1 slots are in use.
+ */
+template <typename T>
+typename SlotMap<T>::Handle SlotMap<T>::insert(const T &item)
+{
+    if (_freeHead == _endOfList && _slots.getSize() == _endOfList)
+        throw std::length_error("Slot map is full");
+
+    // the value goes in last, a throw on the way takes the bookkeeping back
+    bool newSlot = _freeHead == _endOfList;
+    std::uint32_t index = newSlot ? static_cast<std::uint32_t>(_slots.getSize()) : _freeHead;
+    if (newSlot)
+        _slots.append(Slot{0, 0});
+    try
+    {
+        _owners.append(index);
+    }
+    catch (...)
+    {
+        if (newSlot)
+            _slots.popLast();
+        throw;
+    }
+    try
+    {
+        _values.append(item);
+    }
+    catch (...)
+    {
+        _owners.popLast();
+        if (newSlot)
+            _slots.popLast();
+        throw;
+    }
+
+    if (!newSlot)
+        _freeHead = _slots[index].target;
+    _slots[index].target = static_cast<std::uint32_t>(_values.getSize() - 1);
+
+    Handle handle;
+    handle.index = index;
+    handle.generation = _slots[index].generation;
+    return handle;
+}
+
+/**
+ * @brief moves the last value into the erased one's place and puts the
+ *        slot on the free list with a new generation.
+ */
+template <typename T>
+void SlotMap<T>::erase(const Handle &handle)
+{
+    if (findSlot(handle) == nullptr)
+        throw std::out_of_range("Stale slot map handle");
+
+    Slot &slot = _slots[handle.index];
+    size_type last = _values.getSize() - 1;
+    if (slot.target != last)
+    {
+        _values[slot.target] = std::move(_values[last]);
+        _owners[slot.target] = _owners[last];
+        _slots[_owners[last]].target = slot.target;
+    }
+    _values.popLast();
+    _owners.popLast();
+
+    ++slot.generation;
+    slot.target = _freeHead;
+    _freeHead = handle.index;
+}
+
+template <typename T>
+void SlotMap<T>::clear()
+{
+    while (!_values.isEmpty())
+    {
+        Handle handle;
+        handle.index = _owners[_owners.getSize() - 1];
+        handle.generation = _slots[handle.index].generation;
+        erase(handle);
+    }
+}
+
+template <typename T>
+typename SlotMap<T>::Handle SlotMap<T>::getHandle(size_type position) const
+{
+    if (position >= _values.getSize())
+        throw std::out_of_range("Index out of range");
+
+    Handle handle;
+    handle.index = _owners[position];
+    handle.generation = _slots[handle.index].generation;
+    return handle;
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+// a free slot never matches: its generation moved past every handle to it
+template <typename T>
+const typename SlotMap<T>::Slot *SlotMap<T>::findSlot(const Handle &handle) const
+{
+    if (handle.index >= _slots.getSize())
+        return nullptr;
+
+    const Slot &slot = _slots.data()[handle.index];
+    return slot.generation == handle.generation ? &slot : nullptr;
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_SLOT_MAP_CPP
@@ -0,0 +1,164 @@
+#ifndef AISDI_LINEAR_STRING_VECTOR_CPP
+#define AISDI_LINEAR_STRING_VECTOR_CPP
+
+#include "../include/StringVector.hpp"
+#include "Vector.cpp"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace aisdi
+{
+
+template <typename O>
+BasicStringVector<O>::BasicStringVector()
+{
+    _offsets.append(0);
+}
+
+template <typename O>
+BasicStringVector<O>::BasicStringVector(std::initializer_list<std::string_view> il) : BasicStringVector()
+{
+    for (auto elem : il)
+        append(elem);
+}
+
+template <typename O>
+std::string_view BasicStringVector<O>::operator[](const size_type index) const
+{
+    if (index >= getSize())
+        throw std::out_of_range("Index out of range");
+
+    const O *offsets = _offsets.data();
+    return std::string_view(_chars.data() + offsets[index], offsets[index + 1] - offsets[index]);
+}
+
+template <typename O>
+typename BasicStringVector<O>::size_type BasicStringVector<O>::getMemoryUsage() const
+{
+    return sizeof(*this) + _chars.getCapacity() + _offsets.getCapacity() * sizeof(O);
+}
+
+template <typename O>
+void BasicStringVector<O>::reserve(size_type strings, size_type chars)
+{
+    _offsets.reserve(strings + 1);
+    _chars.reserve(chars);
+}
+
+template <typename O>
+void BasicStringVector<O>::append(std::string_view item)
+{
+    if (item.size() > std::numeric_limits<O>::max() - _chars.getSize())
+        throw std::length_error("Character buffer exceeds offset range");
+
+    const char *chars = _chars.data();
+    if (item.data() >= chars && item.data() < chars + _chars.getSize())
+    {
+        // item views our own buffer, which may move while growing
+        std::string copy(item);
+        _chars.appendRange(copy.data(), copy.size());
+    }
+    else
+        _chars.appendRange(item.data(), item.size());
+    _offsets.append(static_cast<O>(_chars.getSize()));
+}
+
+// the view stays valid until the next append
+template <typename O>
+std::string_view BasicStringVector<O>::popLast()
+{
+    if (isEmpty())
+        throw std::length_error("Popped empty vector");
+
+    std::string_view last = (*this)[getSize() - 1];
+    _offsets.popLast();
+    _chars.resizeDefaultInit(_offsets[_offsets.getSize() - 1]);
+    return last;
+}
+
+template <typename O>
+void BasicStringVector<O>::clear()
+{
+    _chars.resizeDefaultInit(0);
+    _offsets.resizeDefaultInit(1);
+}
+
+template <typename O>
+typename BasicStringVector<O>::size_type BasicStringVector<O>::countEqual(std::string_view value) const
+{
+    size_type count = 0;
+    scan([&value](const char *chars, size_type length) {
+        return length == value.size() && std::memcmp(chars, value.data(), length) == 0;
+    },
+         [&count](size_type) { ++count; });
+    return count;
+}
+
+template <typename O>
+void BasicStringVector<O>::findEqual(std::string_view value, Vector<size_type> &out) const
+{
+    scan([&value](const char *chars, size_type length) {
+        return length == value.size() && std::memcmp(chars, value.data(), length) == 0;
+    },
+         [&out](size_type index) { out.append(index); });
+}
+
+template <typename O>
+typename BasicStringVector<O>::size_type BasicStringVector<O>::countPrefix(std::string_view prefix) const
+{
+    size_type count = 0;
+    scan([&prefix](const char *chars, size_type length) {
+        return length >= prefix.size() && std::memcmp(chars, prefix.data(), prefix.size()) == 0;
+    },
+         [&count](size_type) { ++count; });
+    return count;
+}
+
+template <typename O>
+void BasicStringVector<O>::findPrefix(std::string_view prefix, Vector<size_type> &out) const
+{
+    scan([&prefix](const char *chars, size_type length) {
+        return length >= prefix.size() && std::memcmp(chars, prefix.data(), prefix.size()) == 0;
+    },
+         [&out](size_type index) { out.append(index); });
+}
+
+template <typename O>
+typename BasicStringVector<O>::const_iterator BasicStringVector<O>::begin() const
+{
+    return const_iterator(this, 0);
+}
+
+template <typename O>
+typename BasicStringVector<O>::const_iterator BasicStringVector<O>::end() const
+{
+    return const_iterator(this, getSize());
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief walks offsets and characters once, front to back, calling
+ *        visit(index) for every string accepted by match(chars, length).
+ *        Both buffers are read sequentially, which keeps the prefetcher busy.
+ */
+template <typename O>
+template <typename Match, typename Visit>
+void BasicStringVector<O>::scan(Match match, Visit visit) const
+{
+    const char *chars = _chars.data();
+    const O *offsets = _offsets.data();
+    size_type size = getSize();
+
+    for (size_type i = 0; i < size; ++i)
+        if (match(chars + offsets[i], offsets[i + 1] - offsets[i]))
+            visit(i);
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_STRING_VECTOR_CPP
@@ -0,0 +1,356 @@
+#ifndef AISDI_LINEAR_TIERED_VECTOR_CPP
+#define AISDI_LINEAR_TIERED_VECTOR_CPP
+
+#include "../include/TieredVector.hpp"
+#include "Vector.cpp"
+#include <utility>
+
+namespace aisdi
+{
+
+template <typename T>
+TieredVector<T>::TieredVector(std::initializer_list<T> il) : _size(0), _leafCapacity(MinLeafCapacity)
+{
+    for (auto &elem : il)
+        append(elem);
+}
+
+template <typename T>
+TieredVector<T>::TieredVector(const TieredVector<T> &other)
+    : _starts(other._starts), _size(other._size), _leafCapacity(other._leafCapacity)
+{
+    _leaves.reserve(other._leaves.getSize());
+    for (size_type i = 0; i < other._leaves.getSize(); i++)
+    {
+        Leaf *copy = newLeaf();
+        copy->size = other._leaves[i]->size;
+        for (size_type j = 0; j < copy->size; j++)
+            copy->items[j] = other._leaves[i]->items[j];
+        _leaves.append(copy);
+    }
+}
+
+template <typename T>
+TieredVector<T>::TieredVector(TieredVector<T> &&other) : _size(other._size), _leafCapacity(other._leafCapacity)
+{
+    _leaves = std::move(other._leaves);
+    _starts = std::move(other._starts);
+    other._leaves = Vector<Leaf *>();
+    other._starts = Vector<size_type>();
+    other._size = 0;
+}
+
+template <typename T>
+TieredVector<T> &TieredVector<T>::operator=(const TieredVector<T> &other)
+{
+    if (this != &other)
+    {
+        TieredVector<T> copy(other);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+template <typename T>
+TieredVector<T> &TieredVector<T>::operator=(TieredVector<T> &&other)
+{
+    if (this == &other)
+        return *this;
+
+    clear();
+    _leaves = std::move(other._leaves);
+    _starts = std::move(other._starts);
+    _size = other._size;
+    _leafCapacity = other._leafCapacity;
+    other._leaves = Vector<Leaf *>();
+    other._starts = Vector<size_type>();
+    other._size = 0;
+    return *this;
+}
+
+template <typename T>
+T &TieredVector<T>::operator[](const size_type index)
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of range");
+
+    size_type leaf = findLeaf(index);
+    return _leaves[leaf]->items[index - _starts[leaf]];
+}
+
+template <typename T>
+const T &TieredVector<T>::operator[](const size_type index) const
+{
+    if (index >= _size)
+        throw std::out_of_range("Index out of range");
+
+    size_type leaf = findLeaf(index);
+    return _leaves[leaf]->items[index - _starts[leaf]];
+}
+
+template <typename T>
+void TieredVector<T>::append(const T &item)
+{
+    insertAt(_size, item);
+}
+
+template <typename T>
+void TieredVector<T>::prepend(const T &item)
+{
+    insertAt(0, item);
+}
+
+template <typename T>
+void TieredVector<T>::insert(const const_iterator &insertPosition, const T &item)
+{
+    if (insertPosition.getPosition() > _size)
+        throw std::out_of_range("Inserting outside of vector");
+
+    insertAt(insertPosition.getPosition(), item);
+}
+
+template <typename T>
+T TieredVector<T>::popFirst()
+{
+    if (_size == 0)
+        throw std::length_error("Popped empty vector");
+
+    T temp = std::move(_leaves[0]->items[0]);
+    eraseAt(0, 1);
+    return temp;
+}
+
+template <typename T>
+T TieredVector<T>::popLast()
+{
+    if (_size == 0)
+        throw std::length_error("Popped empty vector");
+
+    Leaf *last = _leaves[_leaves.getSize() - 1];
+    T temp = std::move(last->items[last->size - 1]);
+    eraseAt(_size - 1, 1);
+    return temp;
+}
+
+template <typename T>
+void TieredVector<T>::erase(const const_iterator &possition)
+{
+    if (possition.getPosition() >= _size)
+        throw std::out_of_range("Erasing outside of vector");
+
+    eraseAt(possition.getPosition(), 1);
+}
+
+template <typename T>
+void TieredVector<T>::erase(const const_iterator &firstIncluded, const const_iterator &lastExcluded)
+{
+    size_type first = firstIncluded.getPosition();
+    size_type last = lastExcluded.getPosition();
+    if (first > last || last > _size)
+        throw std::out_of_range("Erasing outside of vector");
+
+    eraseAt(first, last - first);
+}
+
+////////////////////////////////////////////////////////////////////
+/////PRIVATE METHODS/////////
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief binary search for the leaf holding the element at index.
+ *        Leaves are never empty, so the answer is unique.
+ */
+template <typename T>
+typename TieredVector<T>::size_type TieredVector<T>::findLeaf(size_type index) const
+{
+    const size_type *starts = _starts.data();
+    size_type low = 0, high = _starts.getSize();
+    while (high - low > 1)
+    {
+        size_type middle = low + (high - low) / 2;
+        if (starts[middle] <= index)
+            low = middle;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+/**
+ * @brief inserts item before the element at index. A full leaf is split in
+ *        half, except at either end of the vector where a fresh leaf is
+ *        started so that appends and prepends fill leaves completely.
+ */
+template <typename T>
+void TieredVector<T>::insertAt(size_type index, const T &item)
+{
+    T copy = item; // item may be one of our elements
+    size_type leaf = index == _size && _size > 0 ? _leaves.getSize() - 1 : findLeaf(index);
+
+    if (_leaves.isEmpty() || (_leaves[leaf]->size == _leafCapacity && (index == 0 || index == _size)))
+    {
+        Leaf *fresh = newLeaf();
+        leaf = index == 0 ? 0 : _leaves.getSize();
+        _leaves.insert(_leaves.begin() + leaf, fresh);
+        _starts.insert(_starts.begin() + leaf, index);
+    }
+    else if (_leaves[leaf]->size == _leafCapacity)
+    {
+        splitLeaf(leaf);
+        if (index - _starts[leaf] > _leaves[leaf]->size)
+            ++leaf;
+    }
+
+    Leaf *target = _leaves[leaf];
+    size_type offset = index - _starts[leaf];
+    for (size_type i = target->size; i > offset; --i)
+        target->items[i] = std::move(target->items[i - 1]);
+    target->items[offset] = std::move(copy);
+    ++target->size;
+    ++_size;
+
+    size_type *starts = _starts.data();
+    for (size_type i = leaf + 1; i < _starts.getSize(); ++i)
+        ++starts[i];
+    rebalance();
+}
+
+/**
+ * @brief removes 'count' elements starting at index, leaf by leaf. Empty
+ *        leaves are dropped and a leaf that fell under a quarter of its
+ *        capacity is merged with a neighbour when both fit in half a leaf.
+ */
+template <typename T>
+void TieredVector<T>::eraseAt(size_type index, size_type count)
+{
+    while (count > 0)
+    {
+        size_type leaf = findLeaf(index);
+        Leaf *target = _leaves[leaf];
+        size_type offset = index - _starts[leaf];
+        size_type take = target->size - offset < count ? target->size - offset : count;
+
+        for (size_type i = offset + take; i < target->size; ++i)
+            target->items[i - take] = std::move(target->items[i]);
+        target->size -= take;
+        _size -= take;
+        count -= take;
+
+        if (target->size == 0)
+        {
+            removeLeaf(leaf);
+        }
+        else if (target->size < _leafCapacity / 4 && _leaves.getSize() > 1)
+        {
+            size_type left = leaf + 1 < _leaves.getSize() ? leaf : leaf - 1;
+            Leaf *first = _leaves[left];
+            Leaf *second = _leaves[left + 1];
+            if (first->size + second->size <= _leafCapacity / 2)
+            {
+                for (size_type i = 0; i < second->size; ++i)
+                    first->items[first->size++] = std::move(second->items[i]);
+                removeLeaf(left + 1);
+            }
+            leaf = left;
+        }
+        updateStartsFrom(leaf);
+    }
+    rebalance();
+}
+
+template <typename T>
+void TieredVector<T>::splitLeaf(size_type leaf)
+{
+    Leaf *left = _leaves[leaf];
+    Leaf *right = newLeaf();
+    size_type half = left->size / 2;
+
+    right->size = left->size - half;
+    for (size_type i = 0; i < right->size; ++i)
+        right->items[i] = std::move(left->items[half + i]);
+    left->size = half;
+
+    _leaves.insert(_leaves.begin() + (leaf + 1), right);
+    _starts.insert(_starts.begin() + (leaf + 1), _starts[leaf] + half);
+}
+
+template <typename T>
+void TieredVector<T>::removeLeaf(size_type leaf)
+{
+    deleteLeaf(_leaves[leaf]);
+    _leaves.erase(_leaves.begin() + leaf);
+    _starts.erase(_starts.begin() + leaf);
+}
+
+template <typename T>
+void TieredVector<T>::updateStartsFrom(size_type leaf)
+{
+    size_type start = leaf == 0 ? 0 : _starts[leaf - 1] + _leaves[leaf - 1]->size;
+    for (size_type i = leaf; i < _leaves.getSize(); ++i)
+    {
+        _starts[i] = start;
+        start += _leaves[i]->size;
+    }
+}
+
+/**
+ * @brief keeps the leaf capacity near sqrt(size). The bounds are four
+ *        times apart, so after a repack the size has to change by a
+ *        constant factor before the next one.
+ */
+template <typename T>
+void TieredVector<T>::rebalance()
+{
+    size_type capacity = _leafCapacity;
+    while (_size > capacity * capacity)
+        capacity *= 2;
+    while (capacity > MinLeafCapacity && _size < capacity * capacity / 16)
+        capacity /= 2;
+
+    if (capacity != _leafCapacity)
+        repack(capacity);
+}
+
+/**
+ * @brief moves all elements into full leaves of the given capacity, O(n).
+ */
+template <typename T>
+void TieredVector<T>::repack(size_type leafCapacity)
+{
+    Vector<Leaf *> old = std::move(_leaves);
+    _leaves = Vector<Leaf *>();
+    _starts = Vector<size_type>();
+    _leafCapacity = leafCapacity;
+
+    Leaf *target = nullptr;
+    for (size_type i = 0; i < old.getSize(); ++i)
+    {
+        for (size_type j = 0; j < old[i]->size; ++j)
+        {
+            if (target == nullptr || target->size == _leafCapacity)
+            {
+                _starts.append(_leaves.isEmpty() ? 0 : _starts[_starts.getSize() - 1] + target->size);
+                target = newLeaf();
+                _leaves.append(target);
+            }
+            target->items[target->size++] = std::move(old[i]->items[j]);
+        }
+        deleteLeaf(old[i]);
+    }
+}
+
+template <typename T>
+void TieredVector<T>::clear()
+{
+    for (size_type i = 0; i < _leaves.getSize(); ++i)
+        deleteLeaf(_leaves[i]);
+
+    _leaves = Vector<Leaf *>();
+    _starts = Vector<size_type>();
+    _size = 0;
+    _leafCapacity = MinLeafCapacity;
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_TIERED_VECTOR_CPP
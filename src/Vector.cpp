@@ -1,38 +1,67 @@
+#ifndef AISDI_LINEAR_VECTOR_CPP
+#define AISDI_LINEAR_VECTOR_CPP
+
 #include "../include/Vector.hpp"
 #include <cassert>
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
+#include <utility>
 #include <iostream>
 namespace aisdi
 {
 
 template <typename T>
-Vector<T>::Vector() : _array(new T[_defaultCapacity]), _capacity(_defaultCapacity), _size(0) {}
+Vector<T>::Vector() : _capacity(_defaultCapacity), _size(0)
+{
+    _array = allocateArray(_capacity, _storage);
+    accountAcquire();
+}
 
 template <typename T>
-Vector<T>::Vector(std::initializer_list<T> il) : _size(0)
+Vector<T>::Vector(size_type count) : _capacity(count), _size(count)
 {
-    size_t size = il.size();
-    _array = new T[size];
-    _capacity = size;
+    if (_isRelocatable)
+        _array = static_cast<T *>(storage::allocateZeroed(count * sizeof(T), _storage));
+    else
+        _array = allocateArray(_capacity, _storage);
+    accountAcquire();
+}
+
+template <typename T>
+Vector<T>::Vector(size_type count, const T &value) : _capacity(count), _size(count)
+{
+    _array = allocateArray(_capacity, _storage);
+    accountAcquire();
+    for (size_type i = 0; i < _size; i++)
+        _array[i] = value;
+}
+
+template <typename T>
+Vector<T>::Vector(std::initializer_list<T> il) : _capacity(il.size()), _size(0)
+{
+    _array = allocateArray(_capacity, _storage);
 
     for (auto &elem : il)
-    {
-        append(elem); //&& somehow(rvalue move)?
-    }
+        _array[_size++] = elem; // capacity is exact, no need to check
+    accountAcquire();
 }
 
 template <typename T>
-Vector<T>::Vector(const Vector<T> &other) : _array(new T[other._size]), _capacity(other._capacity), _size(0)
+Vector<T>::Vector(const Vector<T> &other) : _capacity(other._capacity), _size(other._size)
 {
-    for (const auto &elem : other)
-        append(elem);
+    _array = allocateArray(_capacity, _storage);
+    accountAcquire();
+    for (size_type i = 0; i < _size; i++)
+        _array[i] = other._array[i];
 }
 template <typename T>
-Vector<T>::Vector(Vector<T> &&other) : _array(other._array), _capacity(other._capacity), _size(other._size)
+Vector<T>::Vector(Vector<T> &&other) : _array(nullptr), _capacity(0), _size(0), _storage(storage::Kind::None)
 {
-    other._array = nullptr;
-    other._capacity = 0;
-    other._size = 0;
+#ifdef AISDI_VECTOR_ACCOUNTING
+    _tag = other._tag; // the buffer keeps its attribution
+#endif
+    takeBuffer(other);
 }
 
 template <typename T>
@@ -41,14 +70,19 @@ Vector<T> &Vector<T>::operator=(const Vector<T> &other)
     if (this == &other)
         return *this;
 
-    _capacity = other.getCapacity();
-
-    delete[] _array;
-    _array = new T[_capacity];
-    _size = 0;
+    // the old buffer goes only once the copy exists, so a throw leaves us intact
+    storage::Kind kind;
+    T *copy = allocateArray(other._capacity, kind);
+    for (size_type i = 0; i < other._size; i++)
+        copy[i] = other._array[i];
 
-    for (auto &elem : other)
-        append(elem);
+    releaseArray();
+    _array = copy;
+    _storage = kind;
+    _capacity = other._capacity;
+    _size = other._size;
+    accountAcquire();
+    ++_modifications;
 
     return *this;
 }
@@ -59,13 +93,8 @@ Vector<T> &Vector<T>::operator=(Vector<T> &&other)
     if (this == &other)
         return *this;
 
-    delete[] _array;
-
-    _array = other._array;
-    _capacity = other._capacity;
-    _size = other._size;
-
-    other._array = nullptr;
+    releaseArray();
+    takeBuffer(other);
 
     return *this;
 }
@@ -78,13 +107,253 @@ T &Vector<T>::operator[](const size_type index)
     return _array[index];
 }
 
+template <typename T>
+const T &Vector<T>::operator[](const size_type index) const
+{
+    if (_array == nullptr || index >= _size)
+        throw std::out_of_range("Index out of range");
+
+    return _array[index];
+}
+
+template <typename T>
+Span<T> Vector<T>::slice(size_type from, size_type to)
+{
+    if (from > to || to > _size)
+        throw std::out_of_range("Slice out of range");
+
+    return Span<T>(_array + from, to - from);
+}
+
+template <typename T>
+Span<const T> Vector<T>::slice(size_type from, size_type to) const
+{
+    if (from > to || to > _size)
+        throw std::out_of_range("Slice out of range");
+
+    return Span<const T>(_array + from, to - from);
+}
+
+template <typename T>
+void Vector<T>::reserve(size_type capacity)
+{
+    if (capacity > _capacity)
+        changeCapacityTo(capacity);
+}
+
 template <typename T>
 void Vector<T>::append(const T &item)
 {
     if (_size == _capacity)
         changeCapacityBy(2);
 
-    _array[_size++] = item;
+    _array[_size] = item; // counted only once the copy succeeded
+    ++_size;
+    sizeChanged();
+}
+
+/**
+ * @brief grows or shrinks the vector to size elements, new elements are
+ *        value initialised. Growing an empty vector of a trivial type takes
+ *        a fresh zeroed buffer, so its pages are only zeroed when touched.
+ */
+template <typename T>
+void Vector<T>::resize(size_type size)
+{
+    if (size <= _size)
+    {
+        _size = size;
+        sizeChanged();
+        return;
+    }
+
+    if (_isRelocatable && _size == 0 && size > _capacity)
+    {
+        storage::Kind kind;
+        T *zeroed = static_cast<T *>(storage::allocateZeroed(size * sizeof(T), kind));
+        releaseArray(); // only once the new buffer exists, so a throw leaves us intact
+        _array = zeroed;
+        _storage = kind;
+        _capacity = size;
+        _size = size;
+        accountAcquire();
+        ++_modifications;
+        return;
+    }
+    else if (_isRelocatable)
+    {
+        growFor(size);
+        std::memset(static_cast<void *>(_array + _size), 0, (size - _size) * sizeof(T));
+    }
+    else
+    {
+        growFor(size);
+        for (size_type i = _size; i < size; i++)
+            _array[i] = T();
+    }
+    _size = size;
+    sizeChanged();
+}
+
+template <typename T>
+void Vector<T>::resize(size_type size, const T &value)
+{
+    if (size <= _size)
+    {
+        _size = size;
+        sizeChanged();
+        return;
+    }
+
+    T copy = value; // value may be one of our elements
+    growFor(size);
+    for (size_type i = _size; i < size; i++)
+        _array[i] = copy;
+    _size = size;
+    sizeChanged();
+}
+
+/**
+ * @brief like resize, but new elements of trivial types are left with
+ *        whatever the buffer holds. Useful when they are overwritten next.
+ */
+template <typename T>
+void Vector<T>::resizeDefaultInit(size_type size)
+{
+    if (size > _size)
+        growFor(size);
+
+    if (!_isRelocatable)
+        for (size_type i = _size; i < size; i++)
+            _array[i] = T();
+    _size = size;
+    sizeChanged();
+}
+
+/**
+ * @brief moves all elements of other to the end of this vector. When this
+ *        vector is empty other's buffer is taken over without copying.
+ *        Other is left empty.
+ */
+template <typename T>
+void Vector<T>::append(Vector<T> &&other)
+{
+    if (this == &other)
+        return;
+
+    if (_size == 0)
+    {
+        releaseArray();
+        takeBuffer(other);
+        return;
+    }
+
+    growFor(_size + other._size);
+    for (size_type i = 0; i < other._size; i++)
+        _array[_size++] = std::move(other._array[i]);
+    other._size = 0;
+    sizeChanged();
+    other.sizeChanged();
+}
+
+/**
+ * @brief takes ownership of an external buffer without copying it. Old
+ *        contents are released. For non trivial types all 'capacity' slots
+ *        must hold constructed objects, as new[] would leave them.
+ *
+ * @param buffer first element, freed later with deleter(buffer, capacity)
+ * @param size number of elements in use
+ * @param capacity number of slots in the buffer
+ * @param deleter called once the vector no longer needs the buffer
+ */
+template <typename T>
+void Vector<T>::adopt(T *buffer, size_type size, size_type capacity, Deleter deleter)
+{
+    if (size > capacity)
+        throw std::invalid_argument("Adopted size exceeds capacity");
+    if (buffer == nullptr && capacity > 0)
+        throw std::invalid_argument("Adopting null buffer");
+    if (buffer != nullptr && !deleter)
+        throw std::invalid_argument("Adopting buffer without deleter");
+
+    releaseArray();
+    _array = buffer;
+    _size = size;
+    _capacity = capacity;
+    _storage = buffer ? storage::Kind::Adopted : storage::Kind::None;
+    _deleter = deleter;
+    accountAcquire();
+    ++_modifications;
+}
+
+/**
+ * @brief gives up ownership of the buffer and leaves the vector empty.
+ *        The returned deleter frees the buffer the way it was allocated.
+ */
+template <typename T>
+typename Vector<T>::Buffer Vector<T>::release()
+{
+    accountRelease();
+    Buffer buffer = {_array, _size, _capacity, nullptr};
+    switch (_storage)
+    {
+    case storage::Kind::Array:
+        buffer.deleter = &Vector<T>::deleteArray;
+        break;
+    case storage::Kind::Heap:
+        buffer.deleter = &Vector<T>::freeHeap;
+        break;
+    case storage::Kind::Mapped:
+        buffer.deleter = &Vector<T>::unmapBuffer;
+        break;
+    case storage::Kind::Pooled:
+        buffer.deleter = &Vector<T>::freePooled;
+        break;
+    case storage::Kind::Adopted:
+        buffer.deleter = _deleter;
+        break;
+    case storage::Kind::None:
+        break;
+    }
+
+    _array = nullptr;
+    _size = 0;
+    _capacity = 0;
+    _storage = storage::Kind::None;
+    ++_modifications;
+    return buffer;
+}
+
+template <typename T>
+void Vector<T>::setTag(accounting::Tag tag)
+{
+    if (tag >= accounting::MaxTags)
+        throw std::out_of_range("Unknown accounting tag");
+#ifdef AISDI_VECTOR_ACCOUNTING
+    if (_storage != storage::Kind::None)
+        accounting::detail::retag(_tag, tag, _capacity * sizeof(T), _accountedSlack);
+    _tag = tag;
+#endif
+}
+
+template <typename T>
+accounting::Tag Vector<T>::getTag() const
+{
+#ifdef AISDI_VECTOR_ACCOUNTING
+    return _tag;
+#else
+    return accounting::Untagged;
+#endif
+}
+
+template <typename T>
+void Vector<T>::appendRange(const T *items, size_type count)
+{
+    growFor(_size + count);
+
+    for (size_type i = 0; i < count; i++)
+        _array[_size++] = items[i];
+    sizeChanged();
 }
 
 template <typename T>
@@ -97,6 +366,7 @@ void Vector<T>::prepend(const T &item)
 
     _array[0] = item;
     ++_size;
+    sizeChanged();
 }
 
 template <typename T>
@@ -113,6 +383,7 @@ void Vector<T>::insert(const const_iterator &insertPosition, const T &item)
     moveElementsRight(position);
     _array[position] = item;
     ++_size;
+    sizeChanged();
 }
 
 template <typename T>
@@ -128,8 +399,9 @@ T Vector<T>::popFirst()
     //to get constant/linear amortized time of popping elements
     //we reduce when the size is quarter of capacity instead of half
     if (_capacity > _defaultCapacity && _size < _capacity / 4)
-        changeCapacityBy(1 / 2);
+        changeCapacityBy(0.5);
 
+    sizeChanged();
     return temp;
 }
 
@@ -140,9 +412,11 @@ T Vector<T>::popLast()
         throw std::length_error("Popped empty vector");
 
     if (_capacity > _defaultCapacity && _size < _capacity / 4)
-        changeCapacityBy(1 / 2);
+        changeCapacityBy(0.5);
 
-    return _array[--_size];
+    T temp = _array[--_size];
+    sizeChanged();
+    return temp;
 }
 template <typename T>
 void Vector<T>::erase(const const_iterator &possition)
@@ -155,7 +429,8 @@ void Vector<T>::erase(const const_iterator &possition)
     --_size;
 
     if (_size < _capacity / 4 && _capacity > 8)
-        changeCapacityBy(1 / 2);
+        changeCapacityBy(0.5);
+    sizeChanged();
 }
 
 template <typename T>
@@ -177,6 +452,103 @@ void Vector<T>::erase(const const_iterator &firstIncluded, const const_iterator
     moveElementsLeft(position + nElements, nElements);
 
     _size -= nElements;
+    sizeChanged();
+}
+
+template <typename T>
+void Vector<T>::EditBatch::insertAt(size_type position, const T &item)
+{
+    if (position > _originalSize)
+        throw std::out_of_range("Inserting outside of vector");
+
+    _insertions.append(Insertion{position, item});
+}
+
+template <typename T>
+void Vector<T>::EditBatch::eraseAt(size_type position)
+{
+    if (position >= _originalSize)
+        throw std::out_of_range("Erasing outside of vector");
+
+    _erasures.append(position);
+}
+
+/**
+ * @brief applies the batch and empties it. Original elements are grouped in
+ *        runs that move by the same shift; final positions keep the original
+ *        order, so runs moving left are moved front to back and runs moving
+ *        right back to front without any element overwriting one that has
+ *        not moved yet. Inserted items are moved into the slots left over.
+ *        Throws before touching the vector when a position is erased twice
+ *        or the vector was resized since the batch was started.
+ */
+template <typename T>
+void Vector<T>::EditBatch::commit()
+{
+    if (_vec->_modifications != _modifications)
+        throw std::invalid_argument("Vector modified since beginEdit");
+
+    Insertion *insertions = _insertions.data();
+    size_type *erasures = _erasures.data();
+    size_type insertCount = _insertions.getSize();
+    size_type eraseCount = _erasures.getSize();
+
+    std::stable_sort(insertions, insertions + insertCount,
+                     [](const Insertion &a, const Insertion &b) { return a.position < b.position; });
+    std::sort(erasures, erasures + eraseCount);
+    for (size_type e = 1; e < eraseCount; ++e)
+        if (erasures[e] == erasures[e - 1])
+            throw std::invalid_argument("Element erased twice in edit batch");
+
+    Vector<Run> runs;
+    size_type position = 0, inserted = 0, erased = 0;
+    size_type i = 0, e = 0;
+    while (position < _originalSize || i < insertCount)
+    {
+        size_type next = _originalSize;
+        if (e < eraseCount && erasures[e] < next)
+            next = erasures[e];
+        if (i < insertCount && insertions[i].position < next)
+            next = insertions[i].position;
+
+        difference_type shift = static_cast<difference_type>(inserted) - static_cast<difference_type>(erased);
+        if (next > position && shift != 0)
+            runs.append(Run{position, next, shift});
+        position = next;
+
+        for (; i < insertCount && insertions[i].position == position; ++i, ++inserted)
+            insertions[i].position = position + inserted - erased;
+        if (e < eraseCount && erasures[e] == position)
+        {
+            ++erased;
+            ++e;
+            ++position;
+        }
+    }
+
+    size_type newSize = _originalSize + insertCount - eraseCount;
+    _vec->growFor(newSize);
+    T *array = _vec->_array;
+
+    for (size_type r = 0; r < runs.getSize(); ++r)
+        if (runs[r].shift < 0)
+            for (size_type j = runs[r].from; j < runs[r].to; ++j)
+                array[j + runs[r].shift] = std::move(array[j]);
+
+    for (size_type r = runs.getSize(); r-- > 0;)
+        if (runs[r].shift > 0)
+            for (size_type j = runs[r].to; j-- > runs[r].from;)
+                array[j + runs[r].shift] = std::move(array[j]);
+
+    for (size_type k = 0; k < insertCount; ++k)
+        array[insertions[k].position] = std::move(insertions[k].item);
+
+    _vec->_size = newSize;
+    _vec->sizeChanged();
+    _originalSize = newSize;
+    _modifications = _vec->_modifications;
+    _insertions = Vector<Insertion>();
+    _erasures = Vector<size_type>();
 }
 
 ////////////////////////////////////////////////////////////////////
@@ -196,13 +568,159 @@ template <typename T>
 void Vector<T>::changeCapacityBy(float share)
 {
     assert(share > 0);
-    _capacity = static_cast<int>(_capacity * share); // new capacity
-    T *newArray = new T[_capacity];
+    size_type newCapacity = static_cast<size_type>(_capacity * share);
+    changeCapacityTo(newCapacity > _size ? newCapacity : _size + _defaultCapacity);
+}
+
+/**
+ * @brief reallocates the array so it has exactly newCapacity slots and
+ *        copies elements from old array to new one.
+ *
+ * @tparam T
+ * @param newCapacity capacity after the call, not smaller than size
+ */
+template <typename T>
+void Vector<T>::changeCapacityTo(size_type newCapacity)
+{
+    assert(newCapacity >= _size);
+    if (_isRelocatable && _storage != storage::Kind::Array && _storage != storage::Kind::Adopted)
+    {
+        storage::Kind kind = _storage;
+        T *resized = static_cast<T *>(storage::reallocate(_array, _capacity * sizeof(T), newCapacity * sizeof(T),
+                                                          _size * sizeof(T), kind));
+        accountRelease();
+        _array = resized;
+        _capacity = newCapacity;
+        _storage = kind;
+        accountAcquire();
+        return;
+    }
+
+    storage::Kind kind;
+    T *newArray = allocateArray(newCapacity, kind);
     for (size_type i = 0; i < _size; i++)
         newArray[i] = _array[i];
 
-    delete[] _array;
+    releaseArray();
     _array = newArray;
+    _capacity = newCapacity;
+    _storage = kind;
+    accountAcquire();
+}
+
+/**
+ * @brief makes room for 'required' elements. Grows to the larger of
+ *        required and double the capacity, so repeated calls stay amortised.
+ */
+template <typename T>
+void Vector<T>::growFor(size_type required)
+{
+    if (required > _capacity)
+        changeCapacityTo(required > 2 * _capacity ? required : 2 * _capacity);
+}
+
+/**
+ * @brief allocates room for capacity elements: a raw buffer for trivial
+ *        types, a default constructed array for the others.
+ */
+template <typename T>
+T *Vector<T>::allocateArray(size_type capacity, storage::Kind &kind)
+{
+    if (_isRelocatable)
+        return static_cast<T *>(storage::allocate(capacity * sizeof(T), kind));
+
+    kind = storage::Kind::Array;
+    return new T[capacity];
+}
+
+template <typename T>
+void Vector<T>::releaseArray()
+{
+    accountRelease();
+    if (_storage == storage::Kind::Array)
+        delete[] _array;
+    else if (_storage == storage::Kind::Adopted)
+        _deleter(_array, _capacity);
+    else
+        storage::deallocate(_array, _capacity * sizeof(T), _storage);
+
+    _array = nullptr;
+    _storage = storage::Kind::None;
+}
+
+template <typename T>
+void Vector<T>::takeBuffer(Vector<T> &other)
+{
+    _array = other._array;
+    _capacity = other._capacity;
+    _size = other._size;
+    _storage = other._storage;
+    _deleter = other._deleter;
+#ifdef AISDI_VECTOR_ACCOUNTING
+    _accountedSlack = other._accountedSlack;
+    if (_tag != other._tag && _storage != storage::Kind::None)
+        accounting::detail::retag(other._tag, _tag, _capacity * sizeof(T), _accountedSlack);
+    other._accountedSlack = 0;
+#endif
+
+    other._array = nullptr;
+    other._capacity = 0;
+    other._size = 0;
+    other._storage = storage::Kind::None;
+    ++_modifications;
+    ++other._modifications;
+}
+
+/**
+ * @brief reports the current buffer to the accounting totals, with the
+ *        capacity past the size as slack. Every buffer is reported once
+ *        when it is attached and withdrawn by accountRelease before it goes;
+ *        accountSize keeps its slack current in between.
+ */
+template <typename T>
+void Vector<T>::accountAcquire()
+{
+#ifdef AISDI_VECTOR_ACCOUNTING
+    if (_storage == storage::Kind::None)
+        return;
+    _accountedSlack = (_capacity - _size) * sizeof(T);
+    accounting::detail::acquire<T>(_tag, _capacity * sizeof(T), _accountedSlack);
+#endif
+}
+
+template <typename T>
+void Vector<T>::accountSize()
+{
+#ifdef AISDI_VECTOR_ACCOUNTING
+    if (_storage == storage::Kind::None)
+        return;
+    size_type slack = (_capacity - _size) * sizeof(T);
+    if (slack != _accountedSlack)
+        accounting::detail::adjustSlack<T>(_tag, _accountedSlack, slack);
+    _accountedSlack = slack;
+#endif
+}
+
+/**
+ * @brief called after every change of the size: bumps the modification
+ *        count that invalidates edit batches and updates the slack.
+ */
+template <typename T>
+void Vector<T>::sizeChanged()
+{
+    ++_modifications;
+    accountSize();
+}
+
+template <typename T>
+void Vector<T>::accountRelease()
+{
+#ifdef AISDI_VECTOR_ACCOUNTING
+    if (_storage == storage::Kind::None)
+        return;
+    accounting::detail::release<T>(_tag, _capacity * sizeof(T), _accountedSlack);
+    _accountedSlack = 0;
+#endif
 }
 
 /**
@@ -247,4 +765,6 @@ void Vector<T>::moveElementsLeft(int from, int jump)
         _array[i - jump] = _array[i];
 }
 
-} // namespace aisdi
\ No newline at end of file
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VECTOR_CPP
@@ -0,0 +1,340 @@
+#ifndef AISDI_LINEAR_VECTOR_IO_CPP
+#define AISDI_LINEAR_VECTOR_IO_CPP
+
+#include "../include/VectorIO.hpp"
+#include "Vector.cpp"
+
+#include <charconv>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace aisdi
+{
+namespace io
+{
+namespace detail
+{
+
+namespace
+{
+
+const std::size_t PageSize = 4096;
+const std::size_t StagingSize = 4096; // items the vector grows by while parsing text
+
+inline bool isDelimiter(char c)
+{
+    return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+}
+
+/**
+ * Writes parsed items straight into the vector. The vector is grown ahead
+ * in blocks of StagingSize items without initialising them, and trimmed to
+ * the items actually written by finish().
+ */
+template <typename T>
+class Appender
+{
+public:
+    explicit Appender(Vector<T> &out) : _out(out), _size(out.getSize()) {}
+
+    void push(const T &item)
+    {
+        if (_size == _out.getSize())
+            _out.resizeDefaultInit(_size + StagingSize);
+        _out.data()[_size++] = item;
+    }
+
+    void pushBytes(const char *bytes, std::size_t count)
+    {
+        if (_size + count > _out.getSize())
+            _out.resizeDefaultInit(_size + count);
+        std::memcpy(static_cast<void *>(_out.data() + _size), bytes, count * sizeof(T));
+        _size += count;
+    }
+
+    void finish() { _out.resizeDefaultInit(_size); }
+
+private:
+    Vector<T> &_out;
+    std::size_t _size; // items written, the vector may already be longer
+};
+
+template <typename T>
+void parseNumbers(const char *first, const char *last, Appender<T> &appender, std::true_type)
+{
+    while (true)
+    {
+        while (first != last && isDelimiter(*first))
+            ++first;
+        if (first == last)
+            return;
+
+        T value;
+        auto result = std::from_chars(first, last, value);
+        if (result.ec != std::errc() || (result.ptr != last && !isDelimiter(*result.ptr)))
+            throw std::invalid_argument("Malformed number in input");
+
+        appender.push(value);
+        first = result.ptr;
+    }
+}
+
+template <typename T>
+void parseNumbers(const char *, const char *, Appender<T> &, std::false_type)
+{
+    throw std::invalid_argument("Text format needs an arithmetic type");
+}
+
+template <typename T>
+void readText(ChunkReader &reader, Appender<T> &appender)
+{
+    std::integral_constant<bool, std::is_arithmetic<T>::value> isNumber;
+    std::string carry; // token cut by the end of the previous chunk
+    const char *data;
+    std::size_t length;
+
+    while ((length = reader.next(data)) > 0)
+    {
+        const char *begin = data;
+        const char *end = data + length;
+
+        if (!carry.empty())
+        {
+            const char *delimiter = begin;
+            while (delimiter != end && !isDelimiter(*delimiter))
+                ++delimiter;
+            carry.append(begin, delimiter);
+            if (delimiter == end)
+                continue;
+
+            parseNumbers(carry.data(), carry.data() + carry.size(), appender, isNumber);
+            carry.clear();
+            begin = delimiter;
+        }
+
+        const char *cut = end;
+        while (cut != begin && !isDelimiter(cut[-1]))
+            --cut;
+
+        parseNumbers(begin, cut, appender, isNumber);
+        carry.assign(cut, end);
+    }
+
+    parseNumbers(carry.data(), carry.data() + carry.size(), appender, isNumber);
+}
+
+template <typename T>
+void readBinary(ChunkReader &reader, Appender<T> &appender)
+{
+    char record[sizeof(T)];
+    std::size_t partial = 0; // bytes of a record cut by the end of the previous chunk
+    const char *data;
+    std::size_t length;
+
+    while ((length = reader.next(data)) > 0)
+    {
+        if (partial > 0)
+        {
+            std::size_t take = sizeof(T) - partial < length ? sizeof(T) - partial : length;
+            std::memcpy(record + partial, data, take);
+            partial += take;
+            data += take;
+            length -= take;
+            if (partial < sizeof(T))
+                continue;
+
+            appender.pushBytes(record, 1);
+            partial = 0;
+        }
+
+        appender.pushBytes(data, length / sizeof(T));
+        partial = length % sizeof(T);
+        std::memcpy(record, data + length - partial, partial);
+    }
+
+    if (partial > 0)
+        throw std::invalid_argument("Input ends with a partial record");
+}
+
+} // namespace
+
+inline ChunkReader::ChunkReader(int fd, size_type chunkSize, bool background)
+    : _fd(fd), _current(-1), _finished(false), _stopping(false)
+{
+    _chunkSize = (chunkSize + PageSize - 1) / PageSize * PageSize;
+    if (_chunkSize == 0)
+        _chunkSize = PageSize;
+
+    _buffers[0] = static_cast<char *>(std::aligned_alloc(PageSize, _chunkSize));
+    _buffers[1] = background ? static_cast<char *>(std::aligned_alloc(PageSize, _chunkSize)) : nullptr;
+    _ready[0] = _ready[1] = false;
+    _lengths[0] = _lengths[1] = 0;
+
+    if (_buffers[0] == nullptr || (background && _buffers[1] == nullptr))
+    {
+        std::free(_buffers[0]);
+        std::free(_buffers[1]);
+        throw std::bad_alloc();
+    }
+
+    if (background)
+        _reader = std::thread(&ChunkReader::readAhead, this);
+}
+
+inline ChunkReader::~ChunkReader()
+{
+    if (_reader.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _changed.notify_all();
+        _reader.join();
+    }
+    std::free(_buffers[0]);
+    std::free(_buffers[1]);
+}
+
+inline ChunkReader::size_type ChunkReader::next(const char *&data)
+{
+    if (_finished)
+        return 0;
+
+    if (!_reader.joinable())
+    {
+        data = _buffers[0];
+        _lengths[0] = fill(_buffers[0]);
+        _finished = _lengths[0] == 0;
+        return _lengths[0];
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_current >= 0)
+    {
+        _ready[_current] = false; // caller is done with it, let the thread refill
+        _changed.notify_all();
+    }
+
+    int index = _current < 0 ? 0 : _current ^ 1;
+    _changed.wait(lock, [this, index] { return _ready[index]; });
+    if (_error)
+        std::rethrow_exception(_error);
+
+    _current = index;
+    _finished = _lengths[index] == 0;
+    data = _buffers[index];
+    return _lengths[index];
+}
+
+/**
+ * @brief reads until the buffer holds a whole chunk or input ends. Pipes
+ *        and sockets return short reads, so a single read is not enough.
+ */
+inline ChunkReader::size_type ChunkReader::fill(char *buffer)
+{
+    size_type got = 0;
+    while (got < _chunkSize)
+    {
+        ssize_t result = ::read(_fd, buffer + got, _chunkSize - got);
+        if (result == 0)
+            break;
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            throw std::system_error(errno, std::generic_category(), "Reading input failed");
+        }
+        got += result;
+    }
+    return got;
+}
+
+/**
+ * @brief background thread body: fills the two buffers alternately as soon
+ *        as the caller releases them, stops after end of input.
+ */
+inline void ChunkReader::readAhead()
+{
+    int index = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _changed.wait(lock, [this, index] { return !_ready[index] || _stopping; });
+            if (_stopping)
+                return;
+        }
+
+        size_type length = 0;
+        std::exception_ptr error;
+        try
+        {
+            length = fill(_buffers[index]);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _error = error;
+            _lengths[index] = length;
+            _ready[index] = true;
+        }
+        _changed.notify_all();
+
+        if (length == 0 || error)
+            return;
+        index ^= 1;
+    }
+}
+
+} // namespace detail
+
+template <typename T>
+std::size_t readInto(Vector<T> &out, int fd, Format format, const ReadOptions &options)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "readInto needs trivially copyable items");
+
+    std::size_t before = out.getSize();
+    detail::ChunkReader reader(fd, options.chunkSize, options.backgroundReader);
+    detail::Appender<T> appender(out);
+
+    try
+    {
+        if (format == Format::Text)
+        {
+            detail::readText(reader, appender);
+        }
+        else
+        {
+            struct stat info;
+            if (::fstat(fd, &info) == 0 && S_ISREG(info.st_mode))
+                out.reserve(before + info.st_size / sizeof(T));
+            detail::readBinary(reader, appender);
+        }
+    }
+    catch (...)
+    {
+        out.resizeDefaultInit(before);
+        throw;
+    }
+
+    appender.finish();
+    return out.getSize() - before;
+}
+
+} // namespace io
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VECTOR_IO_CPP
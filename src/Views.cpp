@@ -0,0 +1,34 @@
+#ifndef AISDI_LINEAR_VIEWS_CPP
+#define AISDI_LINEAR_VIEWS_CPP
+
+#include "../include/Views.hpp"
+#include "Vector.cpp"
+
+namespace aisdi
+{
+
+/**
+ * @brief runs the whole pipeline in a single pass and appends its elements
+ *        to out. When the view knows its size, out grows exactly once.
+ *
+ * @param view a view or a Vector
+ * @param out vector the elements are appended to
+ */
+template <typename View, typename Type>
+void collectInto(const View &view, Vector<Type> &out)
+{
+    using Source = views::ViewOf<View>;
+    const Source &source = views::all(view);
+
+    if (source.isSized())
+        out.reserve(out.getSize() + source.getSize());
+
+    source.forEach([&out](const typename Source::value_type &item) {
+        out.append(item);
+        return true;
+    });
+}
+
+} // namespace aisdi
+
+#endif // AISDI_LINEAR_VIEWS_CPP
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+#include "../src/DictVector.cpp"
+#include <cstdint>
+#include <string>
+
+using namespace aisdi;
+
+TEST(DictVectorTest, StoresEachDistinctValueOnce){
+    DictVector<std::string> countries = {"PL", "DE", "PL", "FR", "DE", "PL"};
+
+    ASSERT_EQ(countries.getSize(), 6);
+    ASSERT_EQ(countries.getDictionarySize(), 3);
+    ASSERT_EQ(countries[3], "FR");
+    ASSERT_EQ(countries.getCodes()[2], countries.getCodes()[0]);
+    ASSERT_THROW(countries[6], std::out_of_range);
+}
+
+TEST(DictVectorTest, FiltersOnCodes){
+    DictVector<std::int64_t, std::uint8_t> statuses;
+    for(int i = 0; i < 1000; i++)
+        statuses.append(i % 5);
+
+    ASSERT_EQ(statuses.countEqual(3), 200);
+    ASSERT_EQ(statuses.countEqual(7), 0);
+
+    Vector<std::size_t> found;
+    statuses.findEqual(4, found);
+    ASSERT_EQ(found.getSize(), 200);
+    ASSERT_EQ(found[1], 9);
+}
+
+TEST(DictVectorTest, MaterializeRestoresValues){
+    DictVector<int> values = {3, 1, 3, 2};
+    Vector<int> out;
+    values.materialize(out);
+
+    ASSERT_EQ(out.getSize(), 4);
+    ASSERT_EQ(out[0], 3);
+    ASSERT_EQ(out[3], 2);
+
+    int i = 0;
+    for(int value : values)
+        ASSERT_EQ(value, out[i++]);
+}
+
+TEST(DictVectorTest, ThrowsWhenCodesRunOut){
+    DictVector<int, std::uint8_t> values;
+    for(int i = 0; i < 256; i++)
+        values.append(i);
+    ASSERT_THROW(values.append(256), std::length_error);
+    values.append(255);
+    ASSERT_EQ(values.getSize(), 257);
+}
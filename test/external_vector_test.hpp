@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+#include "../src/ExternalVector.cpp"
+#include <cstdint>
+#include <functional>
+
+using namespace aisdi;
+
+class ExternalVectorTest : public ::testing::Test
+{
+  protected:
+    // 256 bytes of budget: blocks of 16 values, so 1000 values spill 62 blocks
+    ExternalVectorTest() : values(256) {}
+    void SetUp() override {
+        for(std::uint32_t i = 0; i < count; i++)
+            values.append(i * 2654435761u % 100003);
+    }
+    const std::uint32_t count = 1000;
+    ExternalVector<std::uint32_t> values;
+};
+
+TEST_F(ExternalVectorTest, SpillsBlocksBeyondBudget){
+    EXPECT_EQ(values.getBlockSize(), 16);
+    EXPECT_EQ(values.getSize(), count);
+    EXPECT_EQ(values.getSpilledBlocks(), count / 16);
+    EXPECT_EQ(values.get(0), 0);
+    EXPECT_EQ(values.get(500), 500 * 2654435761u % 100003);
+    EXPECT_EQ(values.get(count - 1), (count - 1) * 2654435761u % 100003);
+    EXPECT_THROW(values.get(count), std::out_of_range);
+}
+
+TEST_F(ExternalVectorTest, ScanVisitsEverythingInOrder){
+    std::uint32_t next = 0;
+    std::size_t blocks = 0;
+    values.scan([&blocks](const std::uint32_t *, std::size_t) { blocks++; });
+    values.forEach([&next](std::uint32_t value) {
+        ASSERT_EQ(value, next * 2654435761u % 100003);
+        next++;
+    });
+    EXPECT_EQ(next, count);
+    EXPECT_EQ(blocks, count / 16 + 1);
+}
+
+TEST_F(ExternalVectorTest, SortMergesRunsInSeveralPasses){
+    values.sort();
+    EXPECT_EQ(values.getSize(), count);
+    std::uint32_t previous = 0;
+    std::uint64_t sum = 0, expectedSum = 0;
+    values.forEach([&](std::uint32_t value) {
+        ASSERT_LE(previous, value);
+        previous = value;
+        sum += value;
+    });
+    for(std::uint32_t i = 0; i < count; i++)
+        expectedSum += i * 2654435761u % 100003;
+    EXPECT_EQ(sum, expectedSum);
+
+    values.append(7);
+    values.sort(std::greater<std::uint32_t>());
+    EXPECT_EQ(values.get(count), 0);
+    EXPECT_EQ(values.get(0), previous);
+}
+
+TEST(ExternalVectorSmallTest, StaysInMemoryWithinBudget){
+    ExternalVector<double> values;
+    values.append(3.0);
+    values.append(1.0);
+    values.sort();
+    EXPECT_EQ(values.getSpilledBlocks(), 0);
+    EXPECT_EQ(values.get(0), 1.0);
+    EXPECT_EQ(values.get(1), 3.0);
+}
+
+TEST(ExternalVectorSmallTest, BadDirectoryThrows){
+    EXPECT_THROW(ExternalVector<int>(1024, "/nonexistent/directory"), std::system_error);
+}
@@ -0,0 +1,70 @@
+#include <gtest/gtest.h>
+#include "../src/GapVector.cpp"
+#include <string>
+
+using namespace aisdi;
+
+class GapVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {
+        for(char c : std::string("helloworld"))
+            text.append(c);
+    }
+
+    std::string contents() const {
+        std::string result;
+        for(char c : text)
+            result += c;
+        return result;
+    }
+
+    GapVector<char> text;
+};
+
+TEST_F(GapVectorTest, EditsAtCursor){
+    text.moveCursor(5);
+    text.insertAtCursor(',');
+    text.insertAtCursor(' ');
+    ASSERT_EQ(contents(), "hello, world");
+
+    text.eraseBeforeCursor();
+    text.eraseAfterCursor();
+    ASSERT_EQ(contents(), "hello,orld");
+    ASSERT_EQ(text.getCursor(), 6);
+}
+
+TEST_F(GapVectorTest, IndexingSkipsGap){
+    text.moveCursor(3);
+    ASSERT_EQ(text[2], 'l');
+    ASSERT_EQ(text[3], 'l');
+    ASSERT_EQ(text[9], 'd');
+    ASSERT_THROW(text[10], std::out_of_range);
+}
+
+TEST_F(GapVectorTest, VectorLikeOperations){
+    text.prepend('>');
+    text.insert(text.begin() + 6, '_');
+    text.erase(text.begin() + 1);
+    ASSERT_EQ(contents(), ">ello_world");
+
+    text.erase(text.begin() + 5, text.end());
+    ASSERT_EQ(contents(), ">ello");
+    ASSERT_EQ(text.popFirst(), '>');
+    ASSERT_EQ(text.popLast(), 'o');
+    ASSERT_EQ(text.getSize(), 3);
+}
+
+TEST_F(GapVectorTest, GrowsAroundCursor){
+    text.moveCursor(5);
+    for(int i = 0; i < 100; i++)
+        text.insertAtCursor('x');
+
+    ASSERT_EQ(text.getSize(), 110);
+    ASSERT_EQ(text[4], 'o');
+    ASSERT_EQ(text[104], 'x');
+    ASSERT_EQ(text[105], 'w');
+
+    GapVector<char> copy = text;
+    ASSERT_EQ(copy[105], 'w');
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include "../src/Gather.cpp"
+#include <cstdint>
+#include <string>
+
+using namespace aisdi;
+
+namespace
+{
+
+template <typename T>
+T valueAt(std::size_t i){
+    if constexpr (std::is_arithmetic<T>::value)
+        return static_cast<T>(i % 26);
+    else
+        return T(1, static_cast<char>('a' + i % 26));
+}
+
+} // namespace
+
+template <typename Pair>
+class GatherTest : public ::testing::Test
+{
+};
+
+template <typename T, typename I>
+struct GatherTypes{
+    using Type = T;
+    using Index = I;
+};
+
+using GatherTypeList = ::testing::Types<GatherTypes<double, std::uint32_t>, GatherTypes<double, std::int64_t>,
+                                        GatherTypes<float, std::int32_t>, GatherTypes<std::uint8_t, std::size_t>,
+                                        GatherTypes<std::string, int>>;
+TYPED_TEST_CASE(GatherTest, GatherTypeList);
+
+TYPED_TEST(GatherTest, GatherScatterAndPermute){
+    using T = typename TypeParam::Type;
+    using Index = typename TypeParam::Index;
+    const std::size_t size = 103;
+
+    Vector<T> source;
+    Vector<Index> reversed, permutation;
+    for(std::size_t i = 0; i < size; i++){
+        source.append(valueAt<T>(i));
+        reversed.append(static_cast<Index>(size - 1 - i));
+        permutation.append(static_cast<Index>(i * 37 % size));
+    }
+
+    for(std::size_t distance : {std::size_t(0), std::size_t(4), DefaultPrefetchDistance}){
+        Vector<T> gathered;
+        gather(source, permutation, gathered, distance);
+        ASSERT_EQ(gathered.getSize(), size);
+        for(std::size_t i = 0; i < size; i++)
+            ASSERT_EQ(gathered[i], source[permutation[i]]);
+
+        Vector<T> scattered(size);
+        scatter(gathered, permutation, scattered, distance);
+        for(std::size_t i = 0; i < size; i++)
+            ASSERT_EQ(scattered[i], source[i]);
+    }
+
+    Vector<T> permuted = source;
+    applyPermutation(permuted, permutation);
+    for(std::size_t i = 0; i < size; i++)
+        ASSERT_EQ(permuted[i], source[permutation[i]]);
+
+    applyPermutation(permuted, reversed);
+    EXPECT_EQ(permuted[0], source[permutation[size - 1]]);
+}
+
+TEST(GatherErrorsTest, IndexOutOfRange){
+    Vector<double> source = {1.0, 2.0}, out(2);
+    Vector<int> indices = {0, 2};
+    EXPECT_THROW(gather(source, indices, out), std::out_of_range);
+    EXPECT_THROW(scatter(source, indices, out), std::out_of_range);
+    EXPECT_THROW(gather(source, Vector<int>({-1}), out), std::out_of_range);
+    EXPECT_THROW(scatter(source, Vector<int>({0}), out), std::invalid_argument);
+}
+
+TEST(GatherErrorsTest, RejectsNonPermutations){
+    Vector<int> values = {1, 2, 3};
+    EXPECT_THROW(applyPermutation(values, Vector<int>({0, 1})), std::invalid_argument);
+    EXPECT_THROW(applyPermutation(values, Vector<int>({0, 0, 2})), std::invalid_argument);
+    EXPECT_THROW(applyPermutation(values, Vector<int>({0, 1, 3})), std::invalid_argument);
+    EXPECT_EQ(values[0], 1);
+}
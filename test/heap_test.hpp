@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include "../src/Heap.cpp"
+#include <algorithm>
+#include <functional>
+#include <string>
+
+using namespace aisdi;
+
+struct Timer{
+    std::size_t id;
+    int deadline;
+    bool operator<(const Timer &other) const { return deadline < other.deadline; }
+};
+
+struct TimerId{
+    std::size_t operator()(const Timer &timer) const { return timer.id; }
+};
+
+namespace
+{
+
+template <typename HeapType>
+Vector<int> drain(HeapType &heap){
+    Vector<int> out;
+    while(!heap.isEmpty())
+        out.append(heap.pop());
+    return out;
+}
+
+} // namespace
+
+template <typename HeapType>
+class HeapArityTest : public ::testing::Test
+{
+};
+
+using HeapTypes = ::testing::Types<Heap<int>, Heap<int, std::less<int>, 2>, Heap<int, std::less<int>, 8>>;
+TYPED_TEST_CASE(HeapArityTest, HeapTypes);
+
+TYPED_TEST(HeapArityTest, PopsInOrder){
+    TypeParam heap;
+    for(int i = 0; i < 200; i++)
+        heap.push(i * 37 % 101);
+    EXPECT_EQ(heap.getSize(), 200);
+    EXPECT_EQ(heap.top(), 0);
+
+    Vector<int> out = drain(heap);
+    ASSERT_EQ(out.getSize(), 200);
+    for(std::size_t i = 1; i < out.getSize(); i++)
+        ASSERT_LE(out[i - 1], out[i]);
+}
+
+TYPED_TEST(HeapArityTest, PushRangeHeapifies){
+    TypeParam heap;
+    heap.push(50);
+    Vector<int> batch;
+    for(int i = 0; i < 500; i++)
+        batch.append(i * 7919 % 1000);
+    heap.pushRange(batch);
+    heap.pushRange(batch.data(), 3);
+    EXPECT_EQ(heap.getSize(), 504);
+
+    Vector<int> out = drain(heap);
+    for(std::size_t i = 1; i < out.getSize(); i++)
+        ASSERT_LE(out[i - 1], out[i]);
+}
+
+TEST(HeapTest, EmptyHeapThrows){
+    Heap<int> heap;
+    EXPECT_THROW(heap.top(), std::length_error);
+    EXPECT_THROW(heap.pop(), std::length_error);
+}
+
+TEST(HeapTest, CustomCompareGivesMaxHeap){
+    Heap<std::string, std::greater<std::string>> heap;
+    heap.pushRange(Vector<std::string>({"b", "c", "a"}));
+    EXPECT_EQ(heap.pop(), "c");
+    EXPECT_EQ(heap.pop(), "b");
+}
+
+TEST(HeapTest, DecreaseKeyMovesElementUp){
+    Heap<Timer, std::less<Timer>, 4, TimerId> timers;
+    for(std::size_t id = 0; id < 20; id++)
+        timers.push(Timer{id, static_cast<int>(100 + id)});
+
+    timers.decreaseKey(13, Timer{13, 5});
+    EXPECT_EQ(timers.top().id, 13);
+    EXPECT_THROW(timers.decreaseKey(13, Timer{13, 50}), std::invalid_argument);
+    EXPECT_THROW(timers.decreaseKey(99, Timer{99, 1}), std::invalid_argument);
+
+    EXPECT_EQ(timers.pop().id, 13);
+    EXPECT_FALSE(timers.contains(13));
+    EXPECT_TRUE(timers.contains(14));
+    timers.decreaseKey(19, Timer{19, 0});
+    EXPECT_EQ(timers.pop().id, 19);
+    EXPECT_EQ(timers.pop().id, 0);
+}
+
+TEST(HeapTest, DuplicateIdIsRejected){
+    Heap<Timer, std::less<Timer>, 4, TimerId> timers;
+    timers.push(Timer{1, 10});
+    EXPECT_THROW(timers.push(Timer{1, 5}), std::invalid_argument);
+    EXPECT_EQ(timers.getSize(), 1);
+
+    Vector<Timer> batch = {{2, 3}, {3, 1}, {2, 0}};
+    EXPECT_THROW(timers.pushRange(batch), std::invalid_argument);
+    EXPECT_EQ(timers.getSize(), 3);
+    EXPECT_EQ(timers.pop().id, 3);
+}
+
+TEST(TopKTest, KeepsSmallestInOrder){
+    Vector<int> items;
+    for(int i = 0; i < 1000; i++)
+        items.append(i * 7919 % 1000);
+    topK(items, 5);
+    ASSERT_EQ(items.getSize(), 5);
+    for(int i = 0; i < 5; i++)
+        EXPECT_EQ(items[i], i);
+}
+
+TEST(TopKTest, CustomCompareAndLargeK){
+    Vector<int> items = {3, 9, 1, 7};
+    topK(items, 10, std::greater<int>());
+    ASSERT_EQ(items.getSize(), 4);
+    EXPECT_EQ(items[0], 9);
+    EXPECT_EQ(items[3], 1);
+
+    topK(items, 0);
+    EXPECT_TRUE(items.isEmpty());
+}
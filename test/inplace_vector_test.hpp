@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "../src/InplaceVector.cpp"
+#include <string>
+#include <type_traits>
+
+using namespace aisdi;
+
+namespace
+{
+
+constexpr int sumOfSquares()
+{
+    InplaceVector<int, 8> v;
+    for(int i = 1; i <= 4; i++)
+        v.append(i * i);
+    v.erase(v.begin());
+    int sum = 0;
+    for(int i : v)
+        sum += i;
+    return sum;
+}
+
+} // namespace
+
+static_assert(sumOfSquares() == 4 + 9 + 16, "InplaceVector is usable in constant expressions");
+static_assert(std::is_trivially_copyable<InplaceVector<double, 16>>::value, "trivial payload keeps vector trivial");
+static_assert(!std::is_trivially_copyable<InplaceVector<std::string, 16>>::value, "strings need real copies");
+
+TEST(InplaceVectorTest, TryAppendFailsWhenFull){
+    InplaceVector<int, 3> v;
+    ASSERT_TRUE(v.tryAppend(1));
+    ASSERT_TRUE(v.tryAppend(2));
+    ASSERT_TRUE(v.tryAppend(3));
+    ASSERT_FALSE(v.tryAppend(4));
+    ASSERT_THROW(v.append(4), std::length_error);
+    ASSERT_EQ(v.getSize(), 3);
+}
+
+TEST(InplaceVectorTest, InsertAndEraseKeepOrder){
+    InplaceVector<std::string, 8> v = {"b", "d"};
+    v.prepend("a");
+    v.insert(v.begin() + 2, "c");
+    ASSERT_EQ(v.getSize(), 4);
+    ASSERT_EQ(v[0], "a");
+    ASSERT_EQ(v[2], "c");
+    ASSERT_EQ(v[3], "d");
+
+    v.erase(v.begin() + 1, v.begin() + 3);
+    ASSERT_EQ(v.getSize(), 2);
+    ASSERT_EQ(v[1], "d");
+    ASSERT_THROW(v[2], std::out_of_range);
+}
+
+TEST(InplaceVectorTest, PopReturnsValuesFromBothEnds){
+    InplaceVector<std::string, 4> v = {"x", "y", "z"};
+    ASSERT_EQ(v.popFirst(), "x");
+    ASSERT_EQ(v.popLast(), "z");
+    ASSERT_EQ(v.popLast(), "y");
+    ASSERT_ANY_THROW(v.popFirst());
+}
+
+TEST(InplaceVectorTest, CopiesAreIndependent){
+    InplaceVector<std::string, 4> v = {"x", "y"};
+    InplaceVector<std::string, 4> other = v;
+    other[0] = "changed";
+    ASSERT_EQ(v[0], "x");
+    ASSERT_EQ(other.getSize(), 2);
+}
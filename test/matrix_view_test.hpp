@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include "../src/MatrixView.cpp"
+
+using namespace aisdi;
+
+class MatrixViewTest : public ::testing::TestWithParam<Layout>
+{
+  protected:
+    // element (r, c) is 10 * r + c, stored in the layout under test
+    void SetUp() override {
+        storage = Vector<double>(rows * columns);
+        MatrixView matrix(storage, rows, columns, GetParam());
+        for(std::size_t r = 0; r < rows; r++)
+            for(std::size_t c = 0; c < columns; c++)
+                matrix(r, c) = 10.0 * r + c;
+    }
+    const std::size_t rows = 37, columns = 70;
+    Vector<double> storage;
+};
+
+TEST_P(MatrixViewTest, ViewsShareStorage){
+    MatrixView matrix(storage, rows, columns, GetParam());
+    EXPECT_EQ(matrix.data(), storage.data());
+    EXPECT_EQ(matrix(3, 5), 35.0);
+    EXPECT_EQ(matrix.transposed()(5, 3), 35.0);
+    EXPECT_EQ(matrix.block(2, 4, 3, 3)(1, 1), 35.0);
+
+    matrix.transposed()(6, 1) = -1.0;
+    EXPECT_EQ(matrix(1, 6), -1.0);
+}
+
+TEST_P(MatrixViewTest, ThrowsOutOfRange){
+    MatrixView matrix(storage, rows, columns, GetParam());
+    EXPECT_THROW(matrix(rows, 0), std::out_of_range);
+    EXPECT_THROW(matrix.block(30, 0, 8, 1), std::out_of_range);
+    EXPECT_THROW(MatrixView(storage, rows + 1, columns), std::out_of_range);
+}
+
+TEST_P(MatrixViewTest, TransposeCopiesEveryTile){
+    ConstMatrixView matrix(storage, rows, columns, GetParam());
+    Vector<double> out(rows * columns);
+    MatrixView transposed(out, columns, rows);
+    transpose(matrix, transposed);
+    for(std::size_t r = 0; r < rows; r++)
+        for(std::size_t c = 0; c < columns; c++)
+            ASSERT_EQ(transposed(c, r), 10.0 * r + c);
+
+    EXPECT_THROW(transpose(matrix, MatrixView(out, rows, columns)), std::invalid_argument);
+}
+
+TEST_P(MatrixViewTest, RowAndColumnSums){
+    ConstMatrixView matrix(storage, rows, columns, GetParam());
+    auto sums = rowSums(matrix);
+    ASSERT_EQ(sums.getSize(), rows);
+    EXPECT_EQ(sums[2], 20.0 * columns + columns * (columns - 1) / 2);
+
+    auto maxima = reduceColumns(matrix, 0.0, [](double m, double e) { return e > m ? e : m; });
+    ASSERT_EQ(maxima.getSize(), columns);
+    EXPECT_EQ(maxima[4], 10.0 * (rows - 1) + 4);
+    EXPECT_EQ(columnSums(matrix)[1], 10.0 * rows * (rows - 1) / 2 + rows);
+}
+
+TEST_P(MatrixViewTest, MultiplyMatchesNaiveProduct){
+    MatrixView matrix(storage, rows, columns, GetParam());
+    Vector<double> x(columns), y;
+    for(std::size_t c = 0; c < columns; c++)
+        x[c] = c % 3;
+
+    for(auto view : {matrix, matrix.block(1, 3, 30, 50)}){
+        Vector<double> part(view.getColumns());
+        for(std::size_t c = 0; c < view.getColumns(); c++)
+            part[c] = x[c];
+        multiply(view, part, y);
+        ASSERT_EQ(y.getSize(), view.getRows());
+        for(std::size_t r = 0; r < view.getRows(); r++){
+            double expected = 0;
+            for(std::size_t c = 0; c < view.getColumns(); c++)
+                expected += view(r, c) * part[c];
+            ASSERT_DOUBLE_EQ(y[r], expected);
+        }
+    }
+    EXPECT_THROW(multiply(matrix, y, y), std::invalid_argument);
+}
+
+TEST(MatrixViewStridedTest, MultiplyWithNonUnitStrides){
+    Vector<double> storage(6 * 6, 1.0);
+    MatrixView everyOther(storage.data(), 3, 3, 12, 2);
+    Vector<double> x = {1.0, 2.0, 3.0}, y;
+    multiply(everyOther, x, y);
+    ASSERT_EQ(y.getSize(), 3);
+    EXPECT_EQ(y[0], 6.0);
+    EXPECT_EQ(y[2], 6.0);
+}
+
+INSTANTIATE_TEST_CASE_P(Layouts, MatrixViewTest, ::testing::Values(Layout::RowMajor, Layout::ColumnMajor));
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include "../src/PackedIntVector.cpp"
+#include <cstdint>
+#include <random>
+
+using namespace aisdi;
+
+class PackedIntVectorTest : public ::testing::TestWithParam<PackedIntVector::Encoding>
+{
+  protected:
+    std::uint64_t valueAt(std::size_t i) const { return 1000000 + 3 * i + i % 7; }
+};
+
+TEST_P(PackedIntVectorTest, StoresAppendedValues){
+    PackedIntVector packed(GetParam());
+    for(std::size_t i = 0; i < 1000; i++)
+        packed.append(valueAt(i));
+
+    ASSERT_EQ(packed.getSize(), 1000);
+    for(std::size_t i = 0; i < 1000; i++)
+        ASSERT_EQ(packed[i], valueAt(i));
+    ASSERT_THROW(packed[1000], std::out_of_range);
+}
+
+TEST_P(PackedIntVectorTest, IterationVisitsAllValuesInOrder){
+    PackedIntVector packed(GetParam());
+    for(std::size_t i = 0; i < 777; i++)
+        packed.append(valueAt(i));
+
+    std::size_t i = 0;
+    for(auto value : packed)
+        ASSERT_EQ(value, valueAt(i++));
+    ASSERT_EQ(i, 777);
+}
+
+TEST_P(PackedIntVectorTest, HandlesFullRangeValues){
+    std::mt19937_64 rng(42);
+    Vector<std::uint64_t> expected;
+    PackedIntVector packed(GetParam());
+    for(int i = 0; i < 600; i++){
+        std::uint64_t value = rng() >> (i % 64);
+        expected.append(value);
+        packed.append(value);
+    }
+
+    for(std::size_t i = 0; i < expected.getSize(); i++)
+        ASSERT_EQ(packed[i], expected[i]);
+}
+
+INSTANTIATE_TEST_CASE_P(Encodings, PackedIntVectorTest,
+                        ::testing::Values(PackedIntVector::Encoding::Plain,
+                                          PackedIntVector::Encoding::FrameOfReference,
+                                          PackedIntVector::Encoding::Delta));
+
+TEST(PackedIntVector, SortedIdsTakeFractionOfPlainStorage){
+    PackedIntVector packed(PackedIntVector::Encoding::Delta);
+    for(std::uint64_t i = 0; i < 100000; i++)
+        packed.append(5000000000ull + i * 4);
+
+    ASSERT_LT(packed.getMemoryUsage() * 8, 100000 * sizeof(std::uint64_t));
+}
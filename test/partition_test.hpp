@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "../src/Partition.cpp"
+
+using namespace aisdi;
+
+struct Record{
+    std::size_t key;
+    int order;
+};
+
+namespace
+{
+
+void expectPartitioned(const Vector<Record> &records, const Vector<std::size_t> &offsets, std::size_t nBuckets){
+    ASSERT_EQ(offsets.getSize(), nBuckets + 1);
+    ASSERT_EQ(offsets[nBuckets], records.getSize());
+    for(std::size_t bucket = 0; bucket < nBuckets; bucket++)
+        for(std::size_t i = offsets[bucket]; i < offsets[bucket + 1]; i++){
+            ASSERT_EQ(records[i].key % nBuckets, bucket);
+            if(i > offsets[bucket]){
+                ASSERT_LT(records[i - 1].order, records[i].order);
+            }
+        }
+}
+
+} // namespace
+
+class PartitionTest : public ::testing::TestWithParam<std::size_t>
+{
+  protected:
+    void SetUp() override {
+        for(int i = 0; i < 20000; i++)
+            records.append(Record{static_cast<std::size_t>(i) * 2654435761u % 100003, i});
+    }
+    Vector<Record> records;
+};
+
+TEST_P(PartitionTest, GroupsByBucketKeepingOrder){
+    std::size_t nBuckets = GetParam();
+    auto offsets = partition(records, [nBuckets](const Record &r) { return r.key % nBuckets; }, nBuckets);
+    expectPartitioned(records, offsets, nBuckets);
+}
+
+TEST_P(PartitionTest, ParallelMatchesSequential){
+    std::size_t nBuckets = GetParam();
+    auto offsets = parallelPartition(records, [nBuckets](const Record &r) { return r.key % nBuckets; }, nBuckets, 4);
+    expectPartitioned(records, offsets, nBuckets);
+}
+
+INSTANTIATE_TEST_CASE_P(BucketCounts, PartitionTest, ::testing::Values(1, 7, 256, 1000, 70000));
+
+TEST(PartitionAggregateTest, SumsPerBucket){
+    Vector<int> values;
+    for(int i = 0; i < 1000; i++)
+        values.append(i);
+
+    auto sums = groupAggregate(values, [](int i) { return std::size_t(i % 3); }, 3, 0L,
+                               [](long sum, int i) { return sum + i; });
+    ASSERT_EQ(sums.getSize(), 3);
+    ASSERT_EQ(sums[0], 166833);
+    ASSERT_EQ(sums[0] + sums[1] + sums[2], 499500);
+}
+
+TEST(PartitionAggregateTest, BucketOutOfRangeThrows){
+    Vector<int> values = {1, 2, 3};
+    ASSERT_THROW(partition(values, [](int i) { return std::size_t(i); }, 3), std::out_of_range);
+    ASSERT_THROW(parallelPartition(values, [](int i) { return std::size_t(i); }, 3, 2), std::out_of_range);
+}
+
+TEST(PartitionAggregateTest, EmptyInputHasEmptyBuckets){
+    Vector<int> values;
+    for(auto offsets : {partition(values, [](int) { return std::size_t(0); }, 70000),
+                        parallelPartition(values, [](int) { return std::size_t(0); }, 70000, 4)}){
+        ASSERT_EQ(offsets.getSize(), 70001);
+        ASSERT_EQ(offsets[0], 0);
+        ASSERT_EQ(offsets[70000], 0);
+    }
+}
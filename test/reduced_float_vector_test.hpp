@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "../src/ReducedFloatVector.cpp"
+#include <cmath>
+#include <limits>
+
+using namespace aisdi;
+
+template <typename Format>
+class ReducedFloatFormatTest : public ::testing::Test
+{
+};
+
+using ReducedFloatFormats = ::testing::Types<Float16, BFloat16>;
+TYPED_TEST_CASE(ReducedFloatFormatTest, ReducedFloatFormats);
+
+TYPED_TEST(ReducedFloatFormatTest, EveryEncodingRoundTrips){
+    Vector<std::uint16_t> all(65536);
+    for(std::uint32_t bits = 0; bits < 65536; bits++)
+        all[bits] = static_cast<std::uint16_t>(bits);
+    Vector<float> decoded(65536);
+    Vector<std::uint16_t> encoded(65536);
+    TypeParam::toFloats(all.data(), decoded.data(), all.getSize());
+    TypeParam::fromFloats(decoded.data(), encoded.data(), decoded.getSize());
+
+    for(std::uint32_t bits = 0; bits < 65536; bits++){
+        float single = TypeParam::toFloat(all[bits]);
+        if(std::isnan(decoded[bits])){
+            ASSERT_TRUE(std::isnan(single));
+            ASSERT_TRUE(std::isnan(TypeParam::toFloat(encoded[bits])));
+        }
+        else{
+            ASSERT_EQ(decoded[bits], single) << bits;
+            ASSERT_EQ(encoded[bits], all[bits]) << bits;
+        }
+    }
+}
+
+TYPED_TEST(ReducedFloatFormatTest, SumAndDotMatchDecodedValues){
+    Vector<float> values, weights;
+    for(int i = 0; i < 1000; i++){
+        values.append(static_cast<float>(i % 17) * 0.25f);
+        weights.append(i % 2 ? 1.0f : -0.5f);
+    }
+    BasicReducedFloatVector<TypeParam> reduced(values), reducedWeights(weights);
+    ASSERT_EQ(reduced.getSize(), 1000);
+
+    double sum = 0, dot = 0;
+    for(std::size_t i = 0; i < values.getSize(); i++){
+        sum += reduced[i];
+        dot += reduced[i] * weights[i];
+    }
+    EXPECT_FLOAT_EQ(reduced.sum(), sum);
+    EXPECT_FLOAT_EQ(reduced.dot(weights), dot);
+    EXPECT_FLOAT_EQ(reduced.dot(reducedWeights), dot);
+    EXPECT_THROW(reduced.dot(Vector<float>(3)), std::invalid_argument);
+}
+
+TEST(HalfVectorTest, RoundsToNearestEven){
+    EXPECT_EQ(Float16::fromFloat(1.0f), 0x3c00);
+    EXPECT_EQ(Float16::fromFloat(1.0f + std::ldexp(1.0f, -11)), 0x3c00);
+    EXPECT_EQ(Float16::fromFloat(1.0f + 3 * std::ldexp(1.0f, -11)), 0x3c02);
+    EXPECT_EQ(Float16::fromFloat(-2.0f), 0xc000);
+    EXPECT_EQ(Float16::fromFloat(65519.0f), 0x7bff);
+    EXPECT_EQ(Float16::fromFloat(65520.0f), 0x7c00);
+    EXPECT_EQ(Float16::fromFloat(std::ldexp(1.0f, -25)), 0x0000);
+    EXPECT_EQ(Float16::fromFloat(std::ldexp(1.5f, -25)), 0x0001);
+    EXPECT_EQ(Float16::fromFloat(std::ldexp(1.0f, -14)), 0x0400);
+    EXPECT_EQ(Float16::fromFloat(std::numeric_limits<float>::infinity()), 0x7c00);
+    EXPECT_TRUE(std::isnan(Float16::toFloat(Float16::fromFloat(std::nanf("")))));
+}
+
+TEST(HalfVectorTest, ElementAccessAndDecode){
+    HalfVector half = {0.5f, 1.5f, -3.0f};
+    half.append(1000.0f);
+    half.set(0, 2.0f);
+    EXPECT_EQ(half[0], 2.0f);
+    EXPECT_EQ(half[3], 1000.0f);
+    EXPECT_THROW(half[4], std::out_of_range);
+
+    Vector<float> out;
+    half.decode(out);
+    ASSERT_EQ(out.getSize(), 4);
+    EXPECT_EQ(out[2], -3.0f);
+}
+
+TEST(BF16VectorTest, KeepsFloatRange){
+    BF16Vector bf = {1.0f, 3.0e38f, 1.0e-30f};
+    EXPECT_EQ(BFloat16::fromFloat(1.0f), 0x3f80);
+    EXPECT_NEAR(bf[1] / 3.0e38f, 1.0f, 1.0f / 128);
+    EXPECT_NEAR(bf[2] / 1.0e-30f, 1.0f, 1.0f / 128);
+}
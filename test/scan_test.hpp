@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include "../src/Scan.cpp"
+#include <string>
+
+using namespace aisdi;
+
+namespace
+{
+
+template <typename T>
+Vector<T> sequence(std::size_t size){
+    Vector<T> values;
+    for(std::size_t i = 0; i < size; i++)
+        values.append(static_cast<T>(i * 7 % 13));
+    return values;
+}
+
+template <typename T>
+void expectInclusive(const Vector<T> &in, const Vector<T> &out){
+    ASSERT_EQ(in.getSize(), out.getSize());
+    T sum = T();
+    for(std::size_t i = 0; i < in.getSize(); i++){
+        sum += in[i];
+        ASSERT_EQ(out[i], sum) << "at " << i;
+    }
+}
+
+template <typename T>
+void expectExclusive(const Vector<T> &in, const Vector<T> &out, T initial){
+    ASSERT_EQ(in.getSize(), out.getSize());
+    T sum = initial;
+    for(std::size_t i = 0; i < in.getSize(); i++){
+        ASSERT_EQ(out[i], sum) << "at " << i;
+        sum += in[i];
+    }
+}
+
+template <typename T>
+void expectElements(const Vector<T> &values, std::initializer_list<T> expected){
+    ASSERT_EQ(values.getSize(), expected.size());
+    std::size_t i = 0;
+    for(const T &item : expected)
+        EXPECT_EQ(values[i++], item);
+}
+
+} // namespace
+
+TEST(ScanTest, InclusiveInPlace){
+    Vector<int> values = {3, 1, 4, 1, 5};
+    inclusiveScan(values);
+    expectElements(values, {3, 4, 8, 9, 14});
+}
+
+TEST(ScanTest, ExclusiveInPlaceStartsFromInitial){
+    Vector<int> values = {3, 1, 4, 1, 5};
+    exclusiveScan(values, 10);
+    expectElements(values, {10, 13, 14, 18, 19});
+}
+
+TEST(ScanTest, EmptyVector){
+    Vector<long> values, out;
+    inclusiveScan(values);
+    exclusiveScan(values, out);
+    parallelExclusiveScan(values, 1L, 4);
+    EXPECT_TRUE(values.isEmpty());
+    EXPECT_TRUE(out.isEmpty());
+}
+
+TEST(ScanTest, SimdWidthsMatchSerialSum){
+    for(std::size_t size : {1, 2, 3, 4, 5, 7, 8, 9, 1001}){
+        auto ints = sequence<std::int32_t>(size), intsOut = Vector<std::int32_t>();
+        auto longs = sequence<std::uint64_t>(size), longsOut = Vector<std::uint64_t>();
+        auto doubles = sequence<double>(size), doublesOut = Vector<double>();
+        inclusiveScan(ints, intsOut);
+        inclusiveScan(longs, longsOut);
+        inclusiveScan(doubles, doublesOut);
+        expectInclusive(ints, intsOut);
+        expectInclusive(longs, longsOut);
+        expectInclusive(doubles, doublesOut);
+    }
+}
+
+TEST(ScanTest, ExclusiveSimdWidthsMatchSerialSum){
+    for(std::size_t size : {1, 2, 3, 4, 5, 7, 8, 9, 1001}){
+        auto ints = sequence<std::int32_t>(size), intsOut = ints;
+        auto longs = sequence<std::uint64_t>(size), longsOut = longs;
+        exclusiveScan(intsOut, std::int32_t(-3));
+        exclusiveScan(longsOut, std::uint64_t(3));
+        expectExclusive(ints, intsOut, std::int32_t(-3));
+        expectExclusive(longs, longsOut, std::uint64_t(3));
+    }
+}
+
+TEST(ScanTest, ExclusiveIntoOtherVector){
+    Vector<short> in = {1, 2, 3}, out = {9, 9, 9, 9, 9};
+    exclusiveScan(in, out);
+    expectElements<short>(out, {0, 1, 3});
+}
+
+TEST(ScanTest, WorksForNonTrivialTypes){
+    Vector<std::string> values = {"a", "b", "c"};
+    inclusiveScan(values);
+    expectElements<std::string>(values, {"a", "ab", "abc"});
+}
+
+TEST(ScanTest, ParallelMatchesSerial){
+    for(std::size_t threads : {1, 2, 3, 8}){
+        auto in = sequence<std::int64_t>(500003);
+        auto values = in;
+        parallelInclusiveScan(values, threads);
+        expectInclusive(in, values);
+
+        values = in;
+        parallelExclusiveScan(values, std::int64_t(5), threads);
+        expectExclusive(in, values, std::int64_t(5));
+    }
+}
@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "../src/SearchIndex.cpp"
+#include <algorithm>
+#include <cstdint>
+
+using namespace aisdi;
+
+class SearchIndexTest : public ::testing::TestWithParam<std::size_t>
+{
+  protected:
+    // even numbers with every fifth one repeated
+    void SetUp() override {
+        for(std::uint64_t i = 0; i < GetParam(); i++){
+            sorted.append(2 * i);
+            if(i % 5 == 0)
+                sorted.append(2 * i);
+        }
+    }
+    std::size_t expectedLowerBound(std::uint64_t key) const {
+        const std::uint64_t *first = sorted.data();
+        return std::lower_bound(first, first + sorted.getSize(), key) - first;
+    }
+    Vector<std::uint64_t> sorted;
+};
+
+TEST_P(SearchIndexTest, LowerBoundMatchesBinarySearch){
+    SearchIndex<std::uint64_t> index(sorted);
+    ASSERT_EQ(index.getSize(), sorted.getSize());
+    for(std::uint64_t key = 0; key <= 2 * GetParam() + 1; key++){
+        ASSERT_EQ(index.lowerBound(key), expectedLowerBound(key)) << "key " << key;
+        ASSERT_EQ(index.contains(key), key % 2 == 0 && key < 2 * GetParam());
+    }
+}
+
+TEST_P(SearchIndexTest, BatchedLookupsMatchSingleOnes){
+    SearchIndex<std::uint64_t> index(sorted);
+    Vector<std::uint64_t> keys;
+    for(std::uint64_t i = 0; i < 100; i++)
+        keys.append(i * 7919 % (2 * GetParam() + 3));
+    Vector<std::size_t> positions;
+    index.lowerBounds(keys, positions);
+    ASSERT_EQ(positions.getSize(), keys.getSize());
+    for(std::size_t i = 0; i < keys.getSize(); i++)
+        ASSERT_EQ(positions[i], expectedLowerBound(keys[i]));
+}
+
+INSTANTIATE_TEST_CASE_P(Sizes, SearchIndexTest, ::testing::Values(0, 1, 2, 3, 7, 8, 100, 1023, 5000));
+
+TEST(SearchIndexBuildTest, RejectsUnsortedInput){
+    Vector<int> unsorted = {1, 3, 2};
+    EXPECT_THROW(SearchIndex<int> index(unsorted), std::invalid_argument);
+}
@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include "../src/SetOperations.cpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace aisdi;
+
+namespace
+{
+
+// multiples of step below limit, shifted by offset
+Vector<std::uint32_t> multiples(std::uint32_t step, std::uint32_t offset, std::uint32_t limit){
+    Vector<std::uint32_t> values;
+    for(std::uint32_t value = offset; value < limit; value += step)
+        values.append(value);
+    return values;
+}
+
+std::vector<std::uint32_t> toStd(const Vector<std::uint32_t> &values){
+    return std::vector<std::uint32_t>(values.data(), values.data() + values.getSize());
+}
+
+} // namespace
+
+struct SetShape{
+    std::uint32_t aStep, aOffset, bStep, bOffset, limit;
+};
+
+class SetOperationsTest : public ::testing::TestWithParam<SetShape>
+{
+  protected:
+    void SetUp() override {
+        SetShape shape = GetParam();
+        a = multiples(shape.aStep, shape.aOffset, shape.limit);
+        b = multiples(shape.bStep, shape.bOffset, shape.limit);
+    }
+    Vector<std::uint32_t> a, b;
+};
+
+TEST_P(SetOperationsTest, MatchesStandardAlgorithms){
+    std::vector<std::uint32_t> left = toStd(a), right = toStd(b), expected;
+    Vector<std::uint32_t> out = {42};
+
+    std::set_intersection(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    setIntersect(a, b, out);
+    EXPECT_EQ(toStd(out), expected);
+    EXPECT_EQ(countIntersect(a, b), expected.size());
+    setIntersect(b, a, out);
+    EXPECT_EQ(toStd(out), expected);
+
+    expected.clear();
+    std::set_union(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    setUnion(a, b, out);
+    EXPECT_EQ(toStd(out), expected);
+    EXPECT_EQ(countUnion(a, b), expected.size());
+
+    expected.clear();
+    std::set_difference(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    setDifference(a, b, out);
+    EXPECT_EQ(toStd(out), expected);
+    EXPECT_EQ(countDifference(a, b), expected.size());
+
+    expected.clear();
+    std::set_difference(right.begin(), right.end(), left.begin(), left.end(), std::back_inserter(expected));
+    setDifference(b, a, out);
+    EXPECT_EQ(toStd(out), expected);
+
+    expected.clear();
+    std::merge(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    merge(a, b, out);
+    EXPECT_EQ(toStd(out), expected);
+}
+
+INSTANTIATE_TEST_CASE_P(Shapes, SetOperationsTest, ::testing::Values(
+    SetShape{2, 0, 3, 0, 10000},     // similar sizes
+    SetShape{1, 0, 1, 5, 1000},      // mostly equal
+    SetShape{7, 3, 5, 1, 20},        // shorter than a block
+    SetShape{1, 0, 997, 10, 100000}, // skewed
+    SetShape{991, 1, 1, 0, 100000},  // skewed the other way
+    SetShape{1, 0, 1, 0, 0}));       // empty
+
+TEST(SetOperationsGenericTest, WorksForNonIntegerTypes){
+    Vector<std::string> a = {"ant", "bee", "cat"}, b = {"bee", "cow"}, out;
+    setIntersect(a, b, out);
+    ASSERT_EQ(out.getSize(), 1);
+    EXPECT_EQ(out[0], "bee");
+    setUnion(a, b, out);
+    ASSERT_EQ(out.getSize(), 4);
+    EXPECT_EQ(out[3], "cow");
+}
+
+struct Tagged{
+    int key;
+    int tag;
+    bool operator<(const Tagged &other) const { return key < other.key; }
+};
+
+TEST(SetOperationsGenericTest, MergeKeepsDuplicatesStable){
+    Vector<Tagged> a = {{1, 0}, {2, 0}, {2, 0}}, b = {{2, 1}, {3, 1}}, out;
+    merge(a, b, out);
+    ASSERT_EQ(out.getSize(), 5);
+    for(std::size_t i = 0; i < 3; i++)
+        EXPECT_EQ(out[i].tag, 0);
+    EXPECT_EQ(out[3].tag, 1);
+
+    Vector<Tagged> longer;
+    for(int i = 0; i < 100; i++)
+        longer.append(Tagged{i / 10, 1});
+    merge(longer, a, out);
+    ASSERT_EQ(out.getSize(), 103);
+    EXPECT_EQ(out[10].tag, 1);
+    EXPECT_EQ(out[19].tag, 1);
+    EXPECT_EQ(out[20].tag, 0);
+    EXPECT_EQ(out[30].tag, 1);
+}
+
+TEST(SetOperationsGenericTest, ThrowsWhenOutputAliasesInput){
+    Vector<int> a = {1, 2}, b = {2, 3};
+    EXPECT_THROW(setUnion(a, b, a), std::invalid_argument);
+    EXPECT_THROW(merge(a, b, b), std::invalid_argument);
+}
@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include "../src/Vector.cpp"
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace aisdi;
+
+TEST(SizeClassAllocatorTest, RoundsUpToPowerOfTwoClasses){
+    EXPECT_EQ(pool::classOf(1), 0);
+    EXPECT_EQ(pool::classOf(16), 0);
+    EXPECT_EQ(pool::classOf(17), 1);
+    EXPECT_EQ(pool::classOf(32), 1);
+    EXPECT_EQ(pool::classOf(33), 2);
+    EXPECT_EQ(pool::classOf(pool::MaxClassBytes), pool::ClassCount - 1);
+    EXPECT_EQ(pool::classBytes(pool::ClassCount - 1), pool::MaxClassBytes);
+    EXPECT_TRUE(pool::fits(pool::MaxClassBytes));
+    EXPECT_FALSE(pool::fits(pool::MaxClassBytes + 1));
+}
+
+TEST(SizeClassAllocatorTest, ReusesFreedBlockOnSameThread){
+    void *first = pool::allocate(100);
+    pool::deallocate(first, 100);
+    void *second = pool::allocate(120);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(second) % alignof(std::max_align_t), 0);
+    pool::deallocate(second, 120);
+}
+
+TEST(SizeClassAllocatorTest, ThreadCacheStaysBounded){
+    const std::size_t sizeClass = pool::classOf(64);
+    std::vector<void *> blocks;
+    for(int i = 0; i < 1000; i++)
+        blocks.push_back(pool::allocate(64));
+    for(void *block : blocks)
+        pool::deallocate(block, 64);
+    EXPECT_LE(pool::getCachedBlocks(sizeClass), 2 * pool::batchSize(sizeClass));
+    EXPECT_GT(pool::getCachedBlocks(sizeClass), 0);
+}
+
+TEST(SizeClassAllocatorTest, BlocksFreedOnOtherThreads){
+    const std::size_t sizeClass = pool::classOf(64);
+    const std::size_t count = pool::batchSize(sizeClass);
+    std::vector<void *> made;
+    for(std::size_t i = 0; i < count; i++)
+        made.push_back(pool::allocate(64));
+    const std::size_t sharedBefore = pool::getSharedBlocks(sizeClass);
+
+    // a thread that never allocates hands what it freed back when it exits
+    std::thread releaser([&made] {
+        for(void *block : made)
+            pool::deallocate(block, 64);
+    });
+    releaser.join();
+    EXPECT_EQ(pool::getSharedBlocks(sizeClass), sharedBefore + count);
+
+    std::vector<void *> reused;
+    std::thread taker([&reused, count] {
+        for(std::size_t i = 0; i < count; i++)
+            reused.push_back(pool::allocate(64));
+    });
+    taker.join();
+    std::sort(made.begin(), made.end());
+    std::sort(reused.begin(), reused.end());
+    EXPECT_EQ(reused, made);
+    for(void *block : reused)
+        pool::deallocate(block, 64);
+}
+
+// allocates from its destructor, after the thread's cache has been flushed
+// when it was constructed before the thread first used the pool
+struct TeardownAllocation
+{
+    std::size_t *cachedAfter = nullptr;
+    ~TeardownAllocation() {
+        void *block = pool::allocate(64);
+        *cachedAfter = pool::getCachedBlocks(pool::classOf(64));
+        pool::deallocate(block, 64);
+    }
+};
+
+TEST(SizeClassAllocatorTest, AllocationDuringThreadExitBypassesCache){
+    std::size_t cachedAfter = 1;
+    std::thread worker([&cachedAfter] {
+        static thread_local TeardownAllocation late;
+        late.cachedAfter = &cachedAfter;
+        pool::deallocate(pool::allocate(64), 64);
+    });
+    worker.join();
+    EXPECT_EQ(cachedAfter, 0);
+}
+
+// built by make tester-pooled
+#ifdef AISDI_VECTOR_USE_SIZE_CLASS_ALLOCATOR
+TEST(SizeClassAllocatorTest, BacksSmallVectors){
+    const int *buffer;
+    {
+        Vector<int> values = {1, 2, 3};
+        buffer = values.data();
+    }
+    Vector<int> reused = {4, 5, 6};
+    EXPECT_EQ(reused.data(), buffer);
+
+    // growing within the size class keeps the block
+    Vector<std::uint8_t> bytes(17);
+    const std::uint8_t *block = bytes.data();
+    bytes.reserve(32);
+    EXPECT_EQ(bytes.data(), block);
+
+    Vector<int>::Buffer released = reused.release();
+    released.deleter(released.data, released.capacity);
+}
+#endif
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "../src/SlotMap.cpp"
+#include <stdexcept>
+#include <string>
+
+using namespace aisdi;
+
+TEST(SlotMapTest, HandlesFindTheirValues){
+    SlotMap<std::string> map;
+    auto a = map.insert("a"), b = map.insert("b"), c = map.insert("c");
+    EXPECT_EQ(map.getSize(), 3);
+    EXPECT_EQ(map[a], "a");
+    EXPECT_EQ(map[b], "b");
+    EXPECT_EQ(map[c], "c");
+    map[b] += "!";
+    EXPECT_EQ(*map.find(b), "b!");
+}
+
+TEST(SlotMapTest, EraseKeepsOtherHandlesValid){
+    SlotMap<int> map;
+    SlotMap<int>::Handle handles[10];
+    for(int i = 0; i < 10; i++)
+        handles[i] = map.insert(i);
+
+    map.erase(handles[0]);
+    map.erase(handles[5]);
+    EXPECT_EQ(map.getSize(), 8);
+    for(int i = 0; i < 10; i++){
+        if(i == 0 || i == 5)
+            EXPECT_FALSE(map.contains(handles[i]));
+        else
+            EXPECT_EQ(map[handles[i]], i);
+    }
+}
+
+TEST(SlotMapTest, ValuesStayDense){
+    SlotMap<int> map;
+    auto first = map.insert(1);
+    map.insert(2);
+    map.insert(3);
+    map.erase(first);
+
+    int sum = 0;
+    for(int value : map)
+        sum += value;
+    EXPECT_EQ(sum, 5);
+    EXPECT_EQ(map.end() - map.begin(), 2);
+    EXPECT_EQ(map[map.getHandle(0)], *map.begin());
+}
+
+TEST(SlotMapTest, StaleHandleIsDetectedAfterSlotReuse){
+    SlotMap<int> map;
+    auto old = map.insert(1);
+    map.erase(old);
+    auto fresh = map.insert(2);
+
+    EXPECT_EQ(fresh.index, old.index);
+    EXPECT_NE(fresh, old);
+    EXPECT_EQ(map.find(old), nullptr);
+    EXPECT_THROW(map[old], std::out_of_range);
+    EXPECT_THROW(map.erase(old), std::out_of_range);
+    EXPECT_THROW(map[SlotMap<int>::Handle()], std::out_of_range);
+    EXPECT_EQ(map[fresh], 2);
+}
+
+TEST(SlotMapTest, ClearInvalidatesEverything){
+    SlotMap<int> map;
+    auto a = map.insert(1), b = map.insert(2);
+    map.clear();
+    EXPECT_TRUE(map.isEmpty());
+    EXPECT_FALSE(map.contains(a));
+    EXPECT_FALSE(map.contains(b));
+    EXPECT_EQ(map[map.insert(3)], 3);
+}
+
+namespace
+{
+
+struct PickyValue
+{
+    int value = 0;
+    PickyValue() {}
+    PickyValue(int v) : value(v) {}
+    PickyValue &operator=(const PickyValue &other) {
+        if(other.value < 0)
+            throw std::invalid_argument("negative value");
+        value = other.value;
+        return *this;
+    }
+};
+
+} // namespace
+
+TEST(SlotMapTest, FailedInsertLeavesMapUnchanged){
+    SlotMap<PickyValue> map;
+    auto a = map.insert(PickyValue(1)), b = map.insert(PickyValue(2));
+    map.erase(a);
+
+    // into the freed slot
+    EXPECT_THROW(map.insert(PickyValue(-1)), std::invalid_argument);
+    EXPECT_EQ(map.getSize(), 1);
+    EXPECT_EQ(map.end() - map.begin(), 1);
+    auto c = map.insert(PickyValue(3));
+    EXPECT_EQ(c.index, a.index);
+
+    // into a new slot
+    EXPECT_THROW(map.insert(PickyValue(-1)), std::invalid_argument);
+    EXPECT_EQ(map.getSize(), 2);
+    auto d = map.insert(PickyValue(4));
+    EXPECT_EQ(d.index, 2);
+
+    EXPECT_EQ(map[b].value, 2);
+    EXPECT_EQ(map[c].value, 3);
+    EXPECT_EQ(map[d].value, 4);
+    EXPECT_EQ(map.getSize(), 3);
+}
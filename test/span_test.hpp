@@ -0,0 +1,52 @@
+#include <gtest/gtest.h>
+#include "../src/SharedSlice.cpp"
+#include <thread>
+
+using namespace aisdi;
+
+TEST(SpanTest, SliceViewsVectorWithoutCopying){
+    Vector<int> numbers = {1, 2, 3, 4, 5};
+    Span<int> middle = numbers.slice(1, 4);
+
+    ASSERT_EQ(middle.getSize(), 3);
+    ASSERT_EQ(middle.data(), numbers.data() + 1);
+    middle[0] = 20;
+    ASSERT_EQ(numbers[1], 20);
+
+    Span<const int> readOnly = middle.slice(1, 3);
+    ASSERT_EQ(readOnly[1], 4);
+    ASSERT_THROW(readOnly[2], std::out_of_range);
+    ASSERT_THROW(numbers.slice(3, 6), std::out_of_range);
+}
+
+TEST(SpanTest, SharedSliceKeepsBufferAlive){
+    SharedSlice<int> tail;
+    {
+        Vector<int> numbers = {1, 2, 3, 4, 5};
+        const int *data = numbers.data();
+        SharedSlice<int> whole(std::move(numbers));
+        ASSERT_TRUE(numbers.isEmpty());
+        ASSERT_EQ(whole.data(), data);
+
+        tail = whole.slice(3, 5);
+        ASSERT_EQ(tail.getUseCount(), 2);
+    }
+    ASSERT_EQ(tail.getUseCount(), 1);
+    ASSERT_EQ(tail[0], 4);
+    ASSERT_EQ(tail[1], 5);
+}
+
+TEST(SpanTest, WorkersProcessDisjointSlices){
+    Vector<long> numbers(1000);
+    SharedSlice<long> all(std::move(numbers));
+
+    std::thread first([part = all.slice(0, 500)] { for(auto &i : part) i = 1; });
+    std::thread second([part = all.slice(500, 1000)] { for(auto &i : part) i = 2; });
+    first.join();
+    second.join();
+
+    long sum = 0;
+    for(long i : all)
+        sum += i;
+    ASSERT_EQ(sum, 1500);
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+#include "../src/StringVector.cpp"
+#include <string>
+
+using namespace aisdi;
+
+TEST(StringVectorTest, StoresStringsContiguously){
+    StringVector strings = {"alpha", "", "beta"};
+    strings.append("gamma");
+
+    ASSERT_EQ(strings.getSize(), 4);
+    ASSERT_EQ(strings[0], "alpha");
+    ASSERT_EQ(strings[1], "");
+    ASSERT_EQ(strings[3], "gamma");
+    ASSERT_EQ(strings.getCharCount(), 14);
+    ASSERT_EQ(strings[3].data(), strings[2].data() + 4);
+    ASSERT_THROW(strings[4], std::out_of_range);
+}
+
+TEST(StringVectorTest, IteratesInOrder){
+    CompactStringVector strings = {"a", "bb", "ccc"};
+    std::string joined;
+    for(auto s : strings)
+        joined += std::string(s) + ",";
+    ASSERT_EQ(joined, "a,bb,ccc,");
+
+    ASSERT_EQ(strings.popLast(), "ccc");
+    ASSERT_EQ(strings.getSize(), 2);
+    strings.append("d");
+    ASSERT_EQ(strings[2], "d");
+}
+
+TEST(StringVectorTest, EqualityAndPrefixScans){
+    StringVector strings;
+    for(int i = 0; i < 1000; i++)
+        strings.append("token" + std::to_string(i % 50));
+
+    ASSERT_EQ(strings.countEqual("token7"), 20);
+    ASSERT_EQ(strings.countPrefix("token4"), 220);
+
+    Vector<std::size_t> found;
+    strings.findEqual("token49", found);
+    ASSERT_EQ(found.getSize(), 20);
+    ASSERT_EQ(found[0], 49);
+
+    Vector<std::size_t> prefixed;
+    strings.findPrefix("token1", prefixed);
+    ASSERT_EQ(prefixed.getSize(), 220);
+    ASSERT_EQ(prefixed[1], 10);
+}
+
+TEST(StringVectorTest, AppendingOwnStringIsSafe){
+    StringVector strings = {"repeat"};
+    for(int i = 0; i < 100; i++)
+        strings.append(strings[i]);
+    ASSERT_EQ(strings[100], "repeat");
+}
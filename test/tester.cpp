@@ -1,5 +1,27 @@
 #include <gtest/gtest.h>
 #include "vector_basic_test.hpp"
+#include "packed_int_vector_test.hpp"
+#include "views_test.hpp"
+#include "inplace_vector_test.hpp"
+#include "vector_io_test.hpp"
+#include "gap_vector_test.hpp"
+#include "tiered_vector_test.hpp"
+#include "span_test.hpp"
+#include "string_vector_test.hpp"
+#include "dict_vector_test.hpp"
+#include "partition_test.hpp"
+#include "scan_test.hpp"
+#include "matrix_view_test.hpp"
+#include "search_index_test.hpp"
+#include "set_operations_test.hpp"
+#include "slot_map_test.hpp"
+#include "heap_test.hpp"
+#include "reduced_float_vector_test.hpp"
+#include "gather_test.hpp"
+#include "external_vector_test.hpp"
+#include "vector_accounting_test.hpp"
+#include "vector_edit_batch_test.hpp"
+#include "size_class_allocator_test.hpp"
 // #include "VectorTests.cpp"
 
 TEST(TestTest, TestingTrue)
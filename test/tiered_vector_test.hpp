@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+#include "../src/TieredVector.cpp"
+#include <random>
+#include <vector>
+
+using namespace aisdi;
+
+class TieredVectorTest : public ::testing::Test
+{
+  protected:
+    void expectSameAsReference() {
+        ASSERT_EQ(tiered.getSize(), reference.size());
+        std::size_t i = 0;
+        for(auto value : tiered)
+            ASSERT_EQ(value, reference[i++]);
+        for(i = 0; i < reference.size(); i += 97)
+            ASSERT_EQ(tiered[i], reference[i]);
+    }
+
+    TieredVector<std::uint64_t> tiered;
+    std::vector<std::uint64_t> reference;
+};
+
+TEST_F(TieredVectorTest, AppendsAndPrependsFillLeaves){
+    for(std::uint64_t i = 0; i < 5000; i++){
+        tiered.append(i);
+        tiered.prepend(i);
+        reference.push_back(i);
+        reference.insert(reference.begin(), i);
+    }
+    expectSameAsReference();
+    ASSERT_LE(tiered.getLeafCount(), 10000 / tiered.getLeafCapacity() + 2);
+}
+
+TEST_F(TieredVectorTest, RandomInsertsAndErasesMatchReference){
+    std::mt19937 rng(7);
+    for(int step = 0; step < 20000; step++){
+        if(reference.empty() || rng() % 3 != 0){
+            std::size_t position = rng() % (reference.size() + 1);
+            tiered.insert(tiered.begin() + position, step);
+            reference.insert(reference.begin() + position, step);
+        }
+        else{
+            std::size_t position = rng() % reference.size();
+            tiered.erase(tiered.begin() + position);
+            reference.erase(reference.begin() + position);
+        }
+    }
+    expectSameAsReference();
+}
+
+TEST_F(TieredVectorTest, RangeEraseSpansLeaves){
+    for(std::uint64_t i = 0; i < 3000; i++){
+        tiered.append(i);
+        reference.push_back(i);
+    }
+    tiered.erase(tiered.begin() + 100, tiered.begin() + 2900);
+    reference.erase(reference.begin() + 100, reference.begin() + 2900);
+    expectSameAsReference();
+
+    ASSERT_EQ(tiered.popFirst(), 0);
+    ASSERT_EQ(tiered.popLast(), 2999);
+    ASSERT_THROW(tiered[198], std::out_of_range);
+}
+
+TEST_F(TieredVectorTest, CopyIsIndependent){
+    for(std::uint64_t i = 0; i < 1000; i++)
+        tiered.append(i);
+    TieredVector<std::uint64_t> copy = tiered;
+    copy[500] = 0;
+    ASSERT_EQ(tiered[500], 500);
+
+    TieredVector<std::uint64_t> moved = std::move(copy);
+    ASSERT_EQ(moved.getSize(), 1000);
+    ASSERT_TRUE(copy.isEmpty());
+}
+
+TEST_F(TieredVectorTest, LeafCapacityFollowsSquareRootOfSize){
+    const std::size_t minimum = TieredVector<std::uint64_t>::MinLeafCapacity;
+    for(std::uint64_t i = 0; i < 600000; i++){
+        tiered.append(i);
+        reference.push_back(i);
+    }
+    ASSERT_EQ(tiered.getLeafCapacity(), 2 * minimum);
+    ASSERT_LE(tiered.getLeafCount(), 4 * tiered.getLeafCapacity());
+
+    for(std::uint64_t i = 0; i < 1000; i++){
+        std::size_t position = (i * 7919) % reference.size();
+        tiered.insert(tiered.begin() + position, i);
+        reference.insert(reference.begin() + position, i);
+    }
+    expectSameAsReference();
+
+    tiered.erase(tiered.begin() + 1000, tiered.begin() + 590000);
+    reference.erase(reference.begin() + 1000, reference.begin() + 590000);
+    ASSERT_EQ(tiered.getLeafCapacity(), minimum);
+    expectSameAsReference();
+}
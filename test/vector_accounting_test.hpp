@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "../src/Vector.cpp"
+#include <cstdint>
+#include <utility>
+
+using namespace aisdi;
+
+// built by make tester-accounting; the totals are process wide, so every
+// check compares against a snapshot
+#ifdef AISDI_VECTOR_ACCOUNTING
+
+TEST(VectorAccountingTest, TracksLiveAndSlackBytes){
+    accounting::Usage before = accounting::getUsage();
+    {
+        Vector<std::uint64_t> values(100);
+        values.reserve(200);
+        accounting::Usage during = accounting::getUsage();
+        EXPECT_EQ(during.liveBytes - before.liveBytes, 200 * sizeof(std::uint64_t));
+        EXPECT_EQ(during.slackBytes - before.slackBytes, 100 * sizeof(std::uint64_t));
+        EXPECT_EQ(during.buffers - before.buffers, 1);
+
+        for(int i = 0; i < 50; i++)
+            values.append(i);
+        EXPECT_EQ(accounting::getUsage().slackBytes - before.slackBytes, 50 * sizeof(std::uint64_t));
+        values.popLast();
+        values.resize(100);
+        EXPECT_EQ(accounting::getUsage().slackBytes - before.slackBytes, 100 * sizeof(std::uint64_t));
+        values.resize(200);
+        EXPECT_EQ(accounting::getUsage().slackBytes, before.slackBytes);
+    }
+    accounting::Usage after = accounting::getUsage();
+    EXPECT_EQ(after.liveBytes, before.liveBytes);
+    EXPECT_EQ(after.slackBytes, before.slackBytes);
+    EXPECT_EQ(after.buffers, before.buffers);
+}
+
+TEST(VectorAccountingTest, CountsPerElementType){
+    accounting::Usage before = accounting::getTypeUsage<std::int16_t>();
+    Vector<std::int16_t> values = {1, 2, 3, 4};
+    Vector<std::int16_t> copy(values);
+    accounting::Usage during = accounting::getTypeUsage<std::int16_t>();
+    EXPECT_EQ(during.liveBytes - before.liveBytes, 8 * sizeof(std::int16_t));
+    EXPECT_EQ(during.buffers - before.buffers, 2);
+
+    bool listed = false;
+    accounting::forEachType([&](const char *name, const accounting::Usage &usage) {
+        if (std::string(name) == typeid(std::int16_t).name())
+            listed = usage.buffers == during.buffers;
+    });
+    EXPECT_TRUE(listed);
+}
+
+TEST(VectorAccountingTest, TagFollowsBufferThroughMoves){
+    accounting::Tag tag = accounting::registerTag("accounting-test-cache");
+    EXPECT_EQ(accounting::registerTag("accounting-test-cache"), tag);
+    EXPECT_EQ(accounting::getTagName(tag), "accounting-test-cache");
+
+    accounting::Usage before = accounting::getTagUsage(tag);
+    Vector<int> values(64);
+    values.setTag(tag);
+    EXPECT_EQ(values.getTag(), tag);
+    EXPECT_EQ(accounting::getTagUsage(tag).liveBytes - before.liveBytes, 64 * sizeof(int));
+
+    for(int i = 0; i < 100; i++)
+        values.append(i);
+    EXPECT_EQ(accounting::getTagUsage(tag).liveBytes - before.liveBytes, values.getCapacity() * sizeof(int));
+
+    Vector<int> moved(std::move(values));
+    EXPECT_EQ(moved.getTag(), tag);
+    Vector<int> untagged;
+    untagged = std::move(moved);
+    EXPECT_EQ(accounting::getTagUsage(tag).liveBytes, before.liveBytes);
+
+    EXPECT_THROW(values.setTag(accounting::MaxTags), std::out_of_range);
+    EXPECT_THROW(accounting::getTagName(accounting::MaxTags - 1), std::out_of_range);
+}
+
+TEST(VectorAccountingTest, SoftBudgetFiresOncePerCrossing){
+    std::size_t calls = 0;
+    std::size_t reported = 0;
+    std::size_t live = accounting::getUsage().liveBytes;
+    accounting::setSoftBudget(live + 1000, [&](std::size_t liveBytes) {
+        ++calls;
+        reported = liveBytes;
+    });
+    EXPECT_EQ(accounting::getSoftBudget(), live + 1000);
+
+    Vector<char> small(500);
+    EXPECT_EQ(calls, 0);
+    Vector<char> large(1000);
+    EXPECT_EQ(calls, 1);
+    EXPECT_EQ(reported, live + 1500);
+    Vector<char> more(10);
+    EXPECT_EQ(calls, 1);
+
+    accounting::setSoftBudget(0, nullptr);
+    Vector<char> unlimited(100000);
+    EXPECT_EQ(calls, 1);
+}
+#endif
@@ -21,10 +21,13 @@ class VectorTest : public ::testing::Test
         doublev = Vector<double>();
         intv = Vector<int>();
         intv.append(a); intv.append(b); intv.append(c);
+        remapThreshold = storage::getRemapThreshold();
     }
     void TearDown() override {
-
+        // tests may lower it, restored even when they fail half way
+        storage::setRemapThreshold(remapThreshold);
     }
+    std::size_t remapThreshold;
     Vector<int> intv;
    
     Vector<double> doublev;
@@ -240,3 +243,157 @@ TEST_F(VectorTest, EraseMultipleElemetsOneElement){
     ASSERT_EQ(intv[0], 2);
 }
 
+
+TEST_F(VectorTest, GrowthPastRemapThresholdKeepsValues){
+    storage::setRemapThreshold(4096);
+
+    for(int i = 0; i < 100000; i++)
+        doublev.append(i * 0.5);
+    for(int i = 0; i < 100000; i++)
+        ASSERT_DOUBLE_EQ(doublev[i], i * 0.5);
+
+    while(doublev.getSize() > 10)
+        doublev.popLast();
+    ASSERT_LT(doublev.getCapacity(), 64);
+    ASSERT_DOUBLE_EQ(doublev[9], 4.5);
+}
+
+TEST_F(VectorTest, SizedConstructorValueInitialises){
+    Vector<double> zeros(1000);
+    ASSERT_EQ(zeros.getSize(), 1000);
+    ASSERT_DOUBLE_EQ(zeros[999], 0.0);
+
+    Vector<std::string> words(3, "x");
+    ASSERT_EQ(words[2], "x");
+}
+
+TEST_F(VectorTest, ResizeGrowsAndShrinks){
+    intv.resize(6);
+    ASSERT_EQ(intv.getSize(), 6);
+    ASSERT_EQ(intv[2], c);
+    ASSERT_EQ(intv[5], 0);
+
+    intv.resize(8, 7);
+    ASSERT_EQ(intv[7], 7);
+
+    intv.resize(2);
+    ASSERT_EQ(intv.getSize(), 2);
+    ASSERT_THROW(intv[2], std::out_of_range);
+
+    intv.resize(4);
+    ASSERT_EQ(intv[3], 0);
+}
+
+TEST_F(VectorTest, LargeResizeOfEmptyVectorIsZeroed){
+    doublev.resize(1 << 22);
+    ASSERT_DOUBLE_EQ(doublev[(1 << 22) - 1], 0.0);
+
+    doublev.resizeDefaultInit(10);
+    doublev.resizeDefaultInit(20);
+    ASSERT_EQ(doublev.getSize(), 20);
+}
+
+TEST_F(VectorTest, FailedResizeKeepsOldBuffer){
+    ASSERT_THROW(doublev.resize(std::size_t(1) << 58), std::bad_alloc);
+    ASSERT_EQ(doublev.getSize(), 0);
+    for(int i = 0; i < 100; i++)
+        doublev.append(i);
+    ASSERT_DOUBLE_EQ(doublev[99], 99.0);
+}
+
+namespace
+{
+
+bool failConstruction = false;
+
+struct Fragile
+{
+    int value = 0;
+    Fragile() {
+        if(failConstruction)
+            throw std::bad_alloc();
+    }
+};
+
+} // namespace
+
+TEST_F(VectorTest, FailedCopyAssignmentKeepsOldBuffer){
+    Vector<Fragile> target(3);
+    target[2].value = 7;
+    Vector<Fragile> source(5);
+
+    failConstruction = true;
+    EXPECT_THROW(target = source, std::bad_alloc);
+    failConstruction = false;
+
+    ASSERT_EQ(target.getSize(), 3);
+    ASSERT_EQ(target[2].value, 7);
+    target.append(Fragile());
+    ASSERT_EQ(target.getSize(), 4);
+}
+
+namespace
+{
+
+int freedBuffers = 0;
+
+void countingFree(int *buffer, std::size_t)
+{
+    ++freedBuffers;
+    delete[] buffer;
+}
+
+} // namespace
+
+TEST_F(VectorTest, AdoptTakesBufferWithoutCopying){
+    int *buffer = new int[4]{5, 6, 7, 0};
+    freedBuffers = 0;
+    {
+        Vector<int> adopted;
+        adopted.adopt(buffer, 3, 4, &countingFree);
+        ASSERT_EQ(adopted.data(), buffer);
+        ASSERT_EQ(adopted[2], 7);
+
+        adopted.append(8);
+        ASSERT_EQ(freedBuffers, 0);
+        adopted.append(9); // outgrows the adopted buffer
+        ASSERT_EQ(freedBuffers, 1);
+        ASSERT_EQ(adopted[4], 9);
+    }
+    ASSERT_EQ(freedBuffers, 1);
+}
+
+TEST_F(VectorTest, AdoptRejectsBufferWithoutDeleter){
+    int buffer[4] = {1, 2, 3, 4};
+    ASSERT_THROW(intv.adopt(buffer, 4, 4, nullptr), std::invalid_argument);
+    ASSERT_EQ(intv.getSize(), 3);
+    ASSERT_EQ(intv[2], 3);
+}
+
+TEST_F(VectorTest, ReleaseHandsBufferOut){
+    const int *data = intv.data();
+    Vector<int>::Buffer buffer = intv.release();
+
+    ASSERT_EQ(buffer.data, data);
+    ASSERT_EQ(buffer.size, 3);
+    ASSERT_EQ(buffer.data[1], b);
+    ASSERT_TRUE(intv.isEmpty());
+
+    Vector<int> other;
+    other.adopt(buffer.data, buffer.size, buffer.capacity, buffer.deleter);
+    ASSERT_EQ(other[2], c);
+}
+
+TEST_F(VectorTest, AppendingMovedVectorSplicesWhenEmpty){
+    const int *data = intv.data();
+    Vector<int> empty;
+    empty.append(std::move(intv));
+    ASSERT_EQ(empty.data(), data);
+    ASSERT_EQ(empty.getSize(), 3);
+
+    Vector<int> more = {4, 5};
+    empty.append(std::move(more));
+    ASSERT_EQ(empty.getSize(), 5);
+    ASSERT_EQ(empty[4], 5);
+    ASSERT_TRUE(more.isEmpty());
+}
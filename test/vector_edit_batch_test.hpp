@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include "../src/Vector.cpp"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace aisdi;
+
+TEST(VectorEditBatchTest, AppliesEditsAgainstOriginalPositions){
+    Vector<int> values = {0, 1, 2, 3, 4, 5};
+    auto batch = values.beginEdit();
+    batch.eraseAt(4);
+    batch.insertAt(6, 60);
+    batch.insertAt(2, 20);
+    batch.eraseAt(0);
+    batch.insertAt(2, 21);
+    batch.insertAt(0, -1);
+    EXPECT_EQ(batch.getEditCount(), 6);
+    batch.commit();
+    EXPECT_TRUE(batch.isEmpty());
+
+    const int expected[] = {-1, 1, 20, 21, 2, 3, 5, 60};
+    ASSERT_EQ(values.getSize(), 8);
+    for(std::size_t i = 0; i < values.getSize(); i++)
+        EXPECT_EQ(values[i], expected[i]);
+}
+
+TEST(VectorEditBatchTest, ReusesCapacityWhenResultFits){
+    Vector<int> values;
+    values.reserve(64);
+    for(int i = 0; i < 32; i++)
+        values.append(i);
+    const int *buffer = values.data();
+
+    auto batch = values.beginEdit();
+    for(std::size_t i = 0; i < 32; i += 2)
+        batch.eraseAt(i);
+    for(std::size_t i = 1; i < 32; i += 4)
+        batch.insertAt(i, -static_cast<int>(i));
+    batch.commit();
+
+    EXPECT_EQ(values.data(), buffer);
+    EXPECT_EQ(values.getCapacity(), 64);
+    ASSERT_EQ(values.getSize(), 24);
+    EXPECT_EQ(values[0], -1);
+    EXPECT_EQ(values[1], 1);
+    EXPECT_EQ(values[2], 3);
+    EXPECT_EQ(values[3], -5);
+}
+
+TEST(VectorEditBatchTest, MatchesSequentialEditsOnRandomBatches){
+    std::mt19937 random(48);
+    for(int round = 0; round < 50; round++)
+    {
+        std::size_t size = random() % 200;
+        Vector<std::string> values;
+        std::vector<std::string> original;
+        for(std::size_t i = 0; i < size; i++)
+        {
+            values.append(std::to_string(i));
+            original.push_back(std::to_string(i));
+        }
+
+        // expected result: each original element preceded by its inserts
+        std::vector<std::vector<std::string>> before(size + 1);
+        std::vector<bool> erased(size, false);
+        auto batch = values.beginEdit();
+        std::size_t edits = random() % 100;
+        for(std::size_t k = 0; k < edits; k++)
+        {
+            std::size_t position = random() % (size + 1);
+            if(position < size && !erased[position] && random() % 2 == 0)
+            {
+                erased[position] = true;
+                batch.eraseAt(position);
+            }
+            else
+            {
+                std::string item = "new" + std::to_string(k);
+                before[position].push_back(item);
+                batch.insertAt(position, item);
+            }
+        }
+        batch.commit();
+
+        std::vector<std::string> expected;
+        for(std::size_t i = 0; i <= size; i++)
+        {
+            expected.insert(expected.end(), before[i].begin(), before[i].end());
+            if(i < size && !erased[i])
+                expected.push_back(original[i]);
+        }
+        ASSERT_EQ(values.getSize(), expected.size());
+        for(std::size_t i = 0; i < expected.size(); i++)
+            ASSERT_EQ(values[i], expected[i]);
+    }
+}
+
+TEST(VectorEditBatchTest, RejectsInvalidEdits){
+    Vector<int> values = {1, 2, 3};
+    auto batch = values.beginEdit();
+    EXPECT_THROW(batch.insertAt(4, 0), std::out_of_range);
+    EXPECT_THROW(batch.eraseAt(3), std::out_of_range);
+
+    batch.eraseAt(1);
+    batch.eraseAt(1);
+    EXPECT_THROW(batch.commit(), std::invalid_argument);
+    EXPECT_EQ(values.getSize(), 3);
+
+    auto stale = values.beginEdit();
+    stale.insertAt(0, 0);
+    values.append(4);
+    EXPECT_THROW(stale.commit(), std::invalid_argument);
+    EXPECT_EQ(values[0], 1);
+
+    // same size again, but positions have moved
+    auto shifted = values.beginEdit();
+    shifted.eraseAt(0);
+    values.prepend(0);
+    values.popLast();
+    EXPECT_THROW(shifted.commit(), std::invalid_argument);
+    EXPECT_EQ(values[0], 0);
+
+    auto reused = values.beginEdit();
+    reused.eraseAt(0);
+    reused.commit();
+    reused.insertAt(0, 9);
+    reused.commit();
+    EXPECT_EQ(values[0], 9);
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "../src/VectorIO.cpp"
+#include <cstdint>
+#include <string>
+#include <unistd.h>
+
+using namespace aisdi;
+
+class VectorIOTest : public ::testing::TestWithParam<bool>
+{
+  protected:
+    void SetUp() override {
+        ASSERT_EQ(pipe(fds), 0);
+    }
+    void TearDown() override {
+        close(fds[0]);
+    }
+
+    // writes everything and closes the write end; small enough for the pipe buffer
+    void feed(const void *bytes, std::size_t length) {
+        ASSERT_EQ(write(fds[1], bytes, length), static_cast<ssize_t>(length));
+        close(fds[1]);
+    }
+
+    io::ReadOptions smallChunks() const {
+        io::ReadOptions options;
+        options.chunkSize = 1; // rounded up to a page, still splits tokens
+        options.backgroundReader = GetParam();
+        return options;
+    }
+
+    int fds[2];
+};
+
+TEST_P(VectorIOTest, ParsesNumbersSplitAcrossChunks){
+    std::string text;
+    for(int i = 0; i < 3000; i++)
+        text += std::to_string(i * 7 - 1000) + (i % 2 ? "\n" : " ");
+    feed(text.data(), text.size());
+
+    Vector<std::int64_t> out;
+    ASSERT_EQ(io::readInto(out, fds[0], io::Format::Text, smallChunks()), 3000);
+    for(int i = 0; i < 3000; i++)
+        ASSERT_EQ(out[i], i * 7 - 1000);
+}
+
+TEST_P(VectorIOTest, ParsesFloatingPoint){
+    const char text[] = "1.5\n-2.25\n1e3";
+    feed(text, sizeof(text) - 1);
+
+    Vector<double> out;
+    ASSERT_EQ(io::readInto(out, fds[0], io::Format::Text, smallChunks()), 3);
+    ASSERT_DOUBLE_EQ(out[1], -2.25);
+    ASSERT_DOUBLE_EQ(out[2], 1000.0);
+}
+
+TEST_P(VectorIOTest, ReadsBinaryRecords){
+    Vector<std::uint32_t> expected;
+    for(std::uint32_t i = 0; i < 5000; i++)
+        expected.append(i * 2654435761u);
+    feed(expected.data(), expected.getSize() * sizeof(std::uint32_t));
+
+    Vector<std::uint32_t> out;
+    out.append(42);
+    ASSERT_EQ(io::readInto(out, fds[0], io::Format::Binary, smallChunks()), 5000);
+    ASSERT_EQ(out[0], 42);
+    for(std::size_t i = 0; i < expected.getSize(); i++)
+        ASSERT_EQ(out[i + 1], expected[i]);
+}
+
+TEST_P(VectorIOTest, MalformedInputThrows){
+    const char text[] = "12 abc 14";
+    feed(text, sizeof(text) - 1);
+
+    Vector<int> out = {7};
+    ASSERT_THROW(io::readInto(out, fds[0], io::Format::Text, smallChunks()), std::invalid_argument);
+    ASSERT_EQ(out.getSize(), 1);
+    EXPECT_EQ(out[0], 7);
+}
+
+TEST_P(VectorIOTest, TruncatedBinaryRecordThrows){
+    const char bytes[] = {1, 2, 3, 4, 5, 6};
+    feed(bytes, sizeof(bytes));
+
+    Vector<std::uint32_t> out;
+    ASSERT_THROW(io::readInto(out, fds[0], io::Format::Binary, smallChunks()), std::invalid_argument);
+    EXPECT_EQ(out.getSize(), 0);
+}
+
+struct LargeRecord
+{
+    std::uint32_t id;
+    char payload[1020];
+};
+
+TEST_P(VectorIOTest, ReadsLargeBinaryRecords){
+    Vector<LargeRecord> expected;
+    for(std::uint32_t i = 0; i < 40; i++)
+    {
+        LargeRecord record = {};
+        record.id = i;
+        record.payload[1019] = static_cast<char>(i);
+        expected.append(record);
+    }
+    feed(expected.data(), expected.getSize() * sizeof(LargeRecord));
+
+    Vector<LargeRecord> out;
+    ASSERT_EQ(io::readInto(out, fds[0], io::Format::Binary, smallChunks()), 40);
+    for(std::uint32_t i = 0; i < 40; i++)
+    {
+        EXPECT_EQ(out[i].id, i);
+        EXPECT_EQ(out[i].payload[1019], static_cast<char>(i));
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(ReaderModes, VectorIOTest, ::testing::Values(false, true));
@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+#include "../src/Views.cpp"
+#include <stdexcept>
+
+using namespace aisdi;
+
+class ViewsTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {
+        for(int i = 0; i < 10; i++)
+            numbers.append(i);
+    }
+    Vector<int> numbers;
+    Vector<int> out;
+};
+
+TEST_F(ViewsTest, FilterThenTransformCollectsMatchingValues){
+    collectInto(views::transform(views::filter(numbers, [](int i) { return i % 2 == 1; }),
+                                 [](int i) { return i * i; }),
+                out);
+
+    ASSERT_EQ(out.getSize(), 5);
+    ASSERT_EQ(out[0], 1);
+    ASSERT_EQ(out[4], 81);
+}
+
+TEST_F(ViewsTest, PipeSyntaxComposesViews){
+    collectInto(numbers | views::filter([](int i) { return i % 3 == 0; })
+                        | views::transform([](int i) { return i + 100; })
+                        | views::take(2),
+                out);
+
+    ASSERT_EQ(out.getSize(), 2);
+    ASSERT_EQ(out[0], 100);
+    ASSERT_EQ(out[1], 103);
+}
+
+TEST_F(ViewsTest, SizedViewReservesExactly){
+    collectInto(numbers | views::slice(2, 7) | views::transform([](int i) { return -i; }), out);
+
+    ASSERT_EQ(out.getSize(), 5);
+    ASSERT_EQ(out.getCapacity(), 8);
+    ASSERT_EQ(out[0], -2);
+    ASSERT_EQ(out[4], -6);
+}
+
+TEST_F(ViewsTest, StrideSkipsElements){
+    collectInto(views::stride(numbers, 4), out);
+
+    ASSERT_EQ(out.getSize(), 3);
+    ASSERT_EQ(out[1], 4);
+    ASSERT_EQ(out[2], 8);
+}
+
+TEST_F(ViewsTest, ZipAndEnumeratePairElements){
+    Vector<double> halves;
+    collectInto(views::transform(numbers, [](int i) { return i / 2.0; }), halves);
+
+    Vector<std::pair<std::size_t, std::pair<int, double>>> pairs;
+    collectInto(views::enumerate(views::zip(numbers, views::take(halves, 3))), pairs);
+
+    ASSERT_EQ(pairs.getSize(), 3);
+    ASSERT_EQ(pairs[2].first, 2);
+    ASSERT_EQ(pairs[2].second.first, 2);
+    ASSERT_DOUBLE_EQ(pairs[2].second.second, 1.0);
+}
+
+TEST_F(ViewsTest, InvalidSliceThrows){
+    ASSERT_THROW(views::slice(numbers, 5, 2), std::out_of_range);
+    ASSERT_THROW(views::stride(numbers, 0), std::invalid_argument);
+}